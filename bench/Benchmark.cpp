@@ -0,0 +1,118 @@
+#include "Benchmark.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#if defined(__unix__) || defined(__APPLE__)
+	#include <sys/resource.h>
+#endif
+
+
+namespace
+{
+	std::atomic<std::size_t> allocationCount{0};
+	std::atomic<std::size_t> allocatedBytes{0};
+
+	void* allocate(std::size_t size) {
+		allocationCount.fetch_add(1, std::memory_order_relaxed);
+		allocatedBytes.fetch_add(size, std::memory_order_relaxed);
+
+		if (size == 0)
+			size = 1;
+
+		if (auto* memory = std::malloc(size))
+			return memory;
+
+		throw std::bad_alloc();
+	}
+
+	std::string escapeJson(const std::string& text) {
+		std::string escaped;
+		escaped.reserve(text.size());
+
+		for (const auto character : text)
+		{
+			if (character == '"' || character == '\\')
+				escaped += '\\';
+			escaped += character;
+		}
+
+		return escaped;
+	}
+}
+
+// Counting replacements of global allocation functions. Aligned and nothrow variants forward to these, or are rarely used by benchmarks.
+void* operator new(std::size_t size) {
+	return allocate(size);
+}
+
+void* operator new[](std::size_t size) {
+	return allocate(size);
+}
+
+void operator delete(void* memory) noexcept {
+	std::free(memory);
+}
+
+void operator delete[](void* memory) noexcept {
+	std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept {
+	std::free(memory);
+}
+
+void operator delete[](void* memory, std::size_t) noexcept {
+	std::free(memory);
+}
+
+
+std::size_t GameLibrary::Bench::getAllocationCount() {
+	return allocationCount.load(std::memory_order_relaxed);
+}
+
+std::size_t GameLibrary::Bench::getAllocatedBytes() {
+	return allocatedBytes.load(std::memory_order_relaxed);
+}
+
+std::size_t GameLibrary::Bench::getPeakRssBytes() {
+#if defined(__unix__) || defined(__APPLE__)
+	rusage usage{};
+	if (getrusage(RUSAGE_SELF, &usage) != 0)
+		return 0;
+
+	#ifdef __APPLE__
+	return static_cast<std::size_t>(usage.ru_maxrss);
+	#else
+	// Reported in kilobytes on Linux.
+	return static_cast<std::size_t>(usage.ru_maxrss) * 1024;
+	#endif
+#else
+	return 0;
+#endif
+}
+
+std::vector<GameLibrary::Bench::Result>& GameLibrary::Bench::getResults() {
+	static std::vector<Result> results;
+	return results;
+}
+
+void GameLibrary::Bench::writeJson(std::ostream& stream, const std::vector<Result>& results) {
+	stream << "{\n  \"results\": [";
+
+	for (std::size_t i = 0; i < results.size(); ++i)
+	{
+		const auto& result = results[i];
+
+		stream << (i == 0 ? "\n" : ",\n")
+			   << "    { \"name\": \"" << escapeJson(result.name) << "\""
+			   << ", \"operations\": " << result.operations
+			   << ", \"nsPerOp\": " << result.nanosecondsPerOperation
+			   << ", \"allocations\": " << result.allocations
+			   << ", \"allocatedBytes\": " << result.allocatedBytes
+			   << ", \"peakRssBytes\": " << result.peakRssBytes << " }";
+	}
+
+	stream << "\n  ]\n}\n";
+}
@@ -0,0 +1,97 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <vector>
+
+
+namespace GameLibrary::Bench
+{
+	/*
+	 *  doNotOptimize(): Make value observable, so computation producing it can't be optimized out.
+	 */
+	template<typename T>
+	void doNotOptimize(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+		// Compiler must assume value's memory is read here.
+		asm volatile("" : : "g"(&value) : "memory");
+#else
+		// Volatile pointer, so the store itself can't be elided.
+		static const void* volatile sink;
+		sink = &value;
+#endif
+	}
+
+	/*
+	 *  Result: Measurement of a single benchmark.
+	 */
+	struct Result {
+		std::string name;
+		std::size_t operations = 0;
+		double		nanosecondsPerOperation = 0.0;
+		// Heap allocations made while benchmark ran.
+		std::size_t allocations = 0;
+		std::size_t allocatedBytes = 0;
+		// Peak resident set size of the process after benchmark ran (so far, not just during it), 0 if unknown.
+		std::size_t peakRssBytes = 0;
+	};
+
+	/*
+	 *  getAllocationCount(): Return count of heap allocations made by the process so far (operator new is replaced by the benchmark executable).
+	 */
+	std::size_t getAllocationCount();
+	std::size_t getAllocatedBytes();
+	std::size_t getPeakRssBytes();
+
+	/*
+	 *  getResults(): Return results of all benchmarks measured so far, in order of measurement.
+	 */
+	std::vector<Result>& getResults();
+
+	/*
+	 *  writeJson(): Write results as JSON: { "results": [ { "name": ..., "nsPerOp": ..., ... }, ... ] }.
+	 */
+	void writeJson(std::ostream& stream, const std::vector<Result>& results);
+
+	/*
+	 *  measure(): Run func once, print and return its duration per operation (in nanoseconds).
+	 *  		   Result is also recorded, with allocations made by func and process' peak RSS.
+	 */
+	template<typename F>
+	double measure(const std::string& name, const std::size_t operations, F&& func) {
+		const auto allocationsBefore = getAllocationCount();
+		const auto bytesBefore = getAllocatedBytes();
+
+		const auto start = std::chrono::steady_clock::now();
+		func();
+		const auto end = std::chrono::steady_clock::now();
+		const auto allocationsAfter = getAllocationCount();
+		const auto bytesAfter = getAllocatedBytes();
+
+		Result result;
+		result.name = name;
+		result.operations = operations;
+		result.nanosecondsPerOperation = std::chrono::duration<double, std::nano>(end - start).count() / static_cast<double>(operations);
+		result.allocations = allocationsAfter - allocationsBefore;
+		result.allocatedBytes = bytesAfter - bytesBefore;
+		result.peakRssBytes = getPeakRssBytes();
+
+		std::cout << name << ": " << result.nanosecondsPerOperation << " ns/op, " << result.allocations << " allocations, "
+				  << (result.peakRssBytes >> 20) << " MiB peak RSS\n";
+		getResults().emplace_back(result);
+
+		return result.nanosecondsPerOperation;
+	}
+
+	void runEntityManagerBenchmarks();
+	void runViewBenchmarks();
+	void runParallelViewBenchmarks();
+	void runStaticWorldBenchmarks();
+	void runSnapshotBenchmarks();
+	void runWorldStateBenchmarks();
+	void runTransformHierarchyBenchmarks();
+	void runResourceBenchmarks();
+	void runBroadphaseBenchmarks();
+}
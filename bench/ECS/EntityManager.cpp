@@ -0,0 +1,124 @@
+#include "Benchmark.h"
+
+#include <algorithm>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "GameLibrary/ECS/Entity.h"
+#include "GameLibrary/ECS/EntityManager.h"
+
+using namespace GameLibrary;
+using namespace GameLibrary::ECS;
+
+
+namespace
+{
+	struct Position {
+		float x = 0.f; float y = 0.f;
+	};
+	struct Velocity {
+		float dx = 1.f; float dy = 1.f;
+	};
+	struct Health {
+		int value = 100;
+	};
+
+	struct Actor : BaseEntity<Position, Velocity, Health> {};
+
+	// Fixed, so every run works on identical input.
+	constexpr std::mt19937::result_type seed = 12345;
+
+	// Repeat small benchmarks, so every measurement covers at least ~1M operations.
+	std::size_t getRepetitions(const std::size_t entityCount) {
+		return std::max<std::size_t>(1, 1'000'000 / entityCount);
+	}
+
+	void runAtScale(const std::size_t entityCount) {
+		const auto repetitions = getRepetitions(entityCount);
+		const auto label = std::to_string(entityCount) + " entities, ";
+		const auto operations = entityCount * repetitions;
+
+		EntityManager mgr;
+
+		Bench::measure(label + "create / destroy churn", 2 * operations, [ & ] {
+			std::vector<EntityId> ids;
+			ids.reserve(entityCount);
+
+			for (std::size_t repetition = 0; repetition < repetitions; ++repetition)
+			{
+				for (std::size_t i = 0; i < entityCount; ++i)
+					ids.emplace_back(mgr.addEntity<Actor>());
+				for (const auto id : ids)
+					mgr.removeEntity(id);
+
+				ids.clear();
+			}
+		});
+
+		const auto ids = mgr.addEntities<Actor>(entityCount);
+
+		Bench::measure(label + "iterate 1 component", operations, [ & ] {
+			for (std::size_t repetition = 0; repetition < repetitions; ++repetition)
+			{
+				mgr.view<Position>().forEach([ ] ( Position& position ) {
+					position.x += 1.f;
+				});
+			}
+		});
+		Bench::doNotOptimize(mgr.getComponents<Position>());
+
+		Bench::measure(label + "iterate 2 components", operations, [ & ] {
+			for (std::size_t repetition = 0; repetition < repetitions; ++repetition)
+			{
+				mgr.view<Position, Velocity>().forEach([ ] ( Position& position, const Velocity& velocity ) {
+					position.x += velocity.dx;
+					position.y += velocity.dy;
+				});
+			}
+		});
+		Bench::doNotOptimize(mgr.getComponents<Position>());
+
+		Bench::measure(label + "iterate 3 components", operations, [ & ] {
+			for (std::size_t repetition = 0; repetition < repetitions; ++repetition)
+			{
+				mgr.view<Position, Velocity, Health>().forEach([ ] ( Position& position, const Velocity& velocity, Health& health ) {
+					position.x += velocity.dx;
+					health.value -= 1;
+				});
+			}
+		});
+		Bench::doNotOptimize(mgr.getComponents<Position>());
+
+		auto shuffled = ids;
+		std::shuffle(std::begin(shuffled), std::end(shuffled), std::mt19937(seed));
+
+		Bench::measure(label + "random access by id", operations, [ & ] {
+			float total = 0.f;
+			for (std::size_t repetition = 0; repetition < repetitions; ++repetition)
+			{
+				for (const auto id : shuffled)
+					total += std::as_const(mgr).getComponent<Position>(id).x;
+			}
+			Bench::doNotOptimize(total);
+		});
+
+		Bench::measure(label + "remove / add component", 2 * operations, [ & ] {
+			for (std::size_t repetition = 0; repetition < repetitions; ++repetition)
+			{
+				for (const auto id : ids)
+					mgr.removeComponent<Velocity>(id);
+				for (const auto id : ids)
+					mgr.addComponent<Velocity>(id);
+			}
+		});
+		Bench::doNotOptimize(mgr.getComponents<Velocity>());
+	}
+}
+
+
+void Bench::runEntityManagerBenchmarks() {
+	for (const std::size_t entityCount : { 1'000, 100'000, 1'000'000 })
+		runAtScale(entityCount);
+}
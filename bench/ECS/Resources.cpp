@@ -0,0 +1,57 @@
+#include "Benchmark.h"
+
+#include <utility>
+
+#include "GameLibrary/ECS/Entity.h"
+#include "GameLibrary/ECS/EntityManager.h"
+
+using namespace GameLibrary;
+using namespace GameLibrary::ECS;
+
+
+namespace
+{
+	struct TimeStep {
+		float seconds = 1.f / 60.f;
+	};
+
+	struct Clock : BaseEntity<TimeStep> {};
+}
+
+
+void Bench::runResourceBenchmarks() {
+	constexpr std::size_t accessCount = 10'000'000;
+
+	// What systems had to do before resources: keep global state on a dummy entity.
+	MapEntityManager mapMgr;
+	const auto mapClock = mapMgr.addEntity<Clock>();
+	EntityManager mgr;
+	const auto clock = mgr.addEntity<Clock>();
+	mgr.emplaceResource<TimeStep>();
+
+	float total = 0.f;
+
+	measure("Time step from dummy entity, map storage", accessCount, [ & ] {
+		for (std::size_t i = 0; i < accessCount; ++i)
+		{
+			if (mapMgr.entityHasComponent<TimeStep>(mapClock))
+				total += std::as_const(mapMgr).getComponent<TimeStep>(mapClock).seconds;
+		}
+	});
+	doNotOptimize(total);
+
+	measure("Time step from dummy entity, sparse set storage", accessCount, [ & ] {
+		for (std::size_t i = 0; i < accessCount; ++i)
+		{
+			if (mgr.entityHasComponent<TimeStep>(clock))
+				total += std::as_const(mgr).getComponent<TimeStep>(clock).seconds;
+		}
+	});
+	doNotOptimize(total);
+
+	measure("Time step from world resource", accessCount, [ & ] {
+		for (std::size_t i = 0; i < accessCount; ++i)
+			total += mgr.resource<TimeStep>().seconds;
+	});
+	doNotOptimize(total);
+}
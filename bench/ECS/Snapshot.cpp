@@ -0,0 +1,54 @@
+#include "Benchmark.h"
+
+#include <filesystem>
+#include <string>
+
+#include "GameLibrary/ECS/Entity.h"
+#include "GameLibrary/ECS/EntityManager.h"
+#include "GameLibrary/ECS/Snapshot.h"
+
+using namespace GameLibrary;
+using namespace GameLibrary::ECS;
+
+
+namespace
+{
+	struct Position {
+		float x = 0.f; float y = 0.f;
+	};
+	struct Velocity {
+		float dx = 1.f; float dy = 1.f;
+	};
+	struct Static {};
+
+	struct MovingEntity : BaseEntity<Position, Velocity> {};
+	struct StaticEntity : BaseEntity<Position, Static> {};
+
+	using WorldSnapshot = Snapshot<Position, Velocity, Static>;
+}
+
+
+void Bench::runSnapshotBenchmarks() {
+	constexpr std::size_t entityCount = 1'000'000;
+	const auto path = (std::filesystem::temp_directory_path() / "GameLibraryBench.snap").string();
+
+	EntityManager mgr;
+
+	// Loading has to beat building the same world entity by entity to be worth it.
+	measure("1M entities built with addEntities()", entityCount, [ & ] {
+		mgr.addEntities<MovingEntity>(entityCount / 2);
+		mgr.addEntities<StaticEntity>(entityCount / 2);
+	});
+
+	measure("1M entities saved to snapshot", entityCount, [ & ] {
+		WorldSnapshot::save(mgr, path);
+	});
+
+	EntityManager loaded;
+	measure("1M entities loaded from snapshot", entityCount, [ & ] {
+		WorldSnapshot::load(loaded, path);
+	});
+	doNotOptimize(loaded.getComponents<Position>());
+
+	std::filesystem::remove(path);
+}
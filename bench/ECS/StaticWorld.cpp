@@ -0,0 +1,72 @@
+#include "Benchmark.h"
+
+#include <random>
+#include <vector>
+
+#include "GameLibrary/ECS/Entity.h"
+#include "GameLibrary/ECS/EntityManager.h"
+#include "GameLibrary/ECS/StaticWorld.h"
+
+using namespace GameLibrary;
+using namespace GameLibrary::ECS;
+
+
+namespace
+{
+	struct Position {
+		float x = 0.f; float y = 0.f;
+	};
+	struct Velocity {
+		float dx = 1.f; float dy = 1.f;
+	};
+	struct Health {
+		int value = 100;
+	};
+
+	struct MovingEntity : BaseEntity<Position, Velocity, Health> {};
+
+	template<typename W>
+	void runFor(const std::string& name, W& world) {
+		constexpr std::size_t entityCount = 100'000;
+		constexpr std::size_t lookups = 1'000'000;
+
+		std::vector<EntityId> ids;
+		for (std::size_t i = 0; i < entityCount; ++i)
+			ids.emplace_back(world.template addEntity<MovingEntity>());
+
+		std::mt19937 random(42);
+		std::uniform_int_distribution<std::size_t> pick(0, entityCount - 1);
+		std::vector<EntityId> order;
+		for (std::size_t i = 0; i < lookups; ++i)
+			order.emplace_back(ids[pick(random)]);
+
+		long long sum = 0;
+		Bench::measure(name + ": random getComponent<Health>()", lookups, [ & ] {
+			for (const auto id : order)
+				sum += world.template getComponent<Health>(id).value;
+		});
+		Bench::doNotOptimize(sum);
+
+		Bench::measure(name + ": entityHasComponent<Velocity>()", lookups, [ & ] {
+			for (const auto id : order)
+				sum += world.template entityHasComponent<Velocity>(id);
+		});
+		Bench::doNotOptimize(sum);
+
+		Bench::measure(name + ": Position+Velocity view", entityCount, [ & ] {
+			world.template view<Position, Velocity>().forEach([ ] ( Position& position, const Velocity& velocity ) {
+				position.x += velocity.dx;
+			});
+		});
+		Bench::doNotOptimize(world.template getComponents<Position>());
+	}
+}
+
+
+void Bench::runStaticWorldBenchmarks() {
+	EntityManager mgr;
+	runFor("EntityManager", mgr);
+
+	StaticWorld<Position, Velocity, Health> world;
+	runFor("StaticWorld", world);
+}
@@ -0,0 +1,114 @@
+#include "Benchmark.h"
+
+#include <string>
+#include <vector>
+
+#include "GameLibrary/ECS/Entity.h"
+#include "GameLibrary/ECS/EntityManager.h"
+#include "GameLibrary/ECS/TransformHierarchy.h"
+
+using namespace GameLibrary;
+using namespace GameLibrary::ECS;
+
+
+namespace
+{
+	struct Offset {
+		float x = 0.f; float y = 0.f;
+
+		Offset operator* (const Offset& local) const {
+			return { x + local.x, y + local.y };
+		}
+	};
+
+	// What systems did before the hierarchy: parent id in a component, world transform recomputed by walking up.
+	struct Parent {
+		EntityId id;
+	};
+	struct Local {
+		Offset offset;
+	};
+	struct World {
+		Offset offset;
+	};
+
+	struct Node : BaseEntity<Parent, Local, World> {};
+}
+
+
+void Bench::runTransformHierarchyBenchmarks() {
+	constexpr std::size_t rootCount = 1'000;
+	// Each root has a chain of 4 children, each chain node has 4 leaves - 21 nodes per tree.
+	constexpr std::size_t chainLength = 4;
+	constexpr std::size_t leafCount = 4;
+	constexpr int iterations = 10;
+
+	EntityManager mgr;
+	TransformHierarchy<Offset> hierarchy;
+	std::vector<EntityId> roots;
+
+	for (std::size_t root = 0; root < rootCount; ++root)
+	{
+		auto parent = mgr.addEntity<Node>({ Parent{}, Local{ { 1.f, 1.f } }, World{} });
+		hierarchy.insert(parent, { 1.f, 1.f });
+		roots.emplace_back(parent);
+
+		for (std::size_t depth = 0; depth < chainLength; ++depth)
+		{
+			const auto child = mgr.addEntity<Node>({ Parent{ parent }, Local{ { 1.f, 0.f } }, World{} });
+			hierarchy.insert(child, { 1.f, 0.f }, parent);
+
+			for (std::size_t leaf = 0; leaf < leafCount; ++leaf)
+			{
+				const auto id = mgr.addEntity<Node>({ Parent{ child }, Local{ { 0.f, 1.f } }, World{} });
+				hierarchy.insert(id, { 0.f, 1.f }, child);
+			}
+
+			parent = child;
+		}
+	}
+	hierarchy.update();
+
+	const auto nodeCount = hierarchy.size();
+
+	measure(std::to_string(nodeCount) + " nodes, recursive walk up to roots", nodeCount * iterations, [ & ] {
+		for (int i = 0; i < iterations; ++i)
+		{
+			mgr.view<Parent, Local, World>().forEach([ & ] ( const Parent& parent, const Local& local, World& world ) {
+				auto offset = local.offset;
+				for (auto ancestor = parent.id; !ancestor.isNull(); ancestor = mgr.getStorage().getPool<Parent>().get(ancestor).id)
+					offset = mgr.getStorage().getPool<Local>().get(ancestor).offset * offset;
+
+				world.offset = offset;
+			});
+		}
+	});
+	doNotOptimize(mgr.getComponents<World>());
+
+	measure(std::to_string(nodeCount) + " nodes, hierarchy update with all roots moved", nodeCount * iterations, [ & ] {
+		for (int i = 0; i < iterations; ++i)
+		{
+			for (const auto root : roots)
+				hierarchy.setLocal(root, { static_cast<float>(i), 0.f });
+			hierarchy.update();
+		}
+	});
+	doNotOptimize(hierarchy.getWorlds());
+
+	measure(std::to_string(nodeCount) + " nodes, hierarchy update with 1% of roots moved", nodeCount * iterations, [ & ] {
+		for (int i = 0; i < iterations; ++i)
+		{
+			for (std::size_t root = 0; root < rootCount; root += 100)
+				hierarchy.setLocal(roots[root], { static_cast<float>(i), 1.f });
+			hierarchy.update();
+		}
+	});
+	doNotOptimize(hierarchy.getWorlds());
+
+	measure(std::to_string(rootCount / 2) + " subtrees reparented in one batch", rootCount / 2, [ & ] {
+		for (std::size_t root = 1; root < rootCount; root += 2)
+			hierarchy.setParent(roots[root], roots[root - 1]);
+		hierarchy.update();
+	});
+	doNotOptimize(hierarchy.getWorlds());
+}
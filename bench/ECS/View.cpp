@@ -0,0 +1,137 @@
+#include "Benchmark.h"
+
+#include "GameLibrary/ECS/Entity.h"
+#include "GameLibrary/ECS/EntityManager.h"
+#include "GameLibrary/Utilities/ThreadPool.h"
+
+using namespace GameLibrary;
+using namespace GameLibrary::ECS;
+
+
+namespace
+{
+	struct Position {
+		float x = 0.f; float y = 0.f;
+	};
+	struct Velocity {
+		float dx = 1.f; float dy = 1.f;
+	};
+	struct Static {};
+
+	struct MovingEntity : BaseEntity<Position, Velocity> {};
+	struct StaticEntity : BaseEntity<Position, Static> {};
+
+	// Half of entities move, other half doesn't.
+	template<typename M>
+	void populate(M& mgr, const std::size_t count) {
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			if (i % 2 == 0)
+				mgr.template addEntity<MovingEntity>();
+			else
+				mgr.template addEntity<StaticEntity>();
+		}
+	}
+}
+
+
+void Bench::runViewBenchmarks() {
+	constexpr std::size_t entityCount = 100'000;
+	constexpr int iterations = 10;
+
+	MapEntityManager mapMgr;
+	EntityManager mgr;
+	populate(mapMgr, entityCount);
+	populate(mgr, entityCount);
+
+	// What systems had to do before views: intersect per-type maps by hand.
+	measure("Position+Velocity manual map intersection", entityCount * iterations, [ & ] {
+		for (int i = 0; i < iterations; ++i)
+		{
+			auto& velocities = mapMgr.getComponents<Velocity>();
+
+			for (auto& [id, position] : mapMgr.getComponents<Position>())
+			{
+				const auto velocityIt = velocities.find(id);
+				if (velocityIt == std::end(velocities))
+					continue;
+
+				const auto& velocity = velocityIt->second;
+
+				position.x += velocity.dx;
+				position.y += velocity.dy;
+			}
+		}
+	});
+	doNotOptimize(mapMgr.getComponents<Position>());
+
+	measure("Position+Velocity view", entityCount * iterations, [ & ] {
+		for (int i = 0; i < iterations; ++i)
+		{
+			mgr.view<Position, Velocity>().forEach([ ] ( Position& position, const Velocity& velocity ) {
+				position.x += velocity.dx;
+				position.y += velocity.dy;
+			});
+		}
+	});
+	doNotOptimize(mgr.getComponents<Position>());
+
+	EntityManager groupMgr;
+	populate(groupMgr, entityCount);
+	const auto group = groupMgr.group<Position, Velocity>();
+
+	measure("Position+Velocity owning group", entityCount * iterations, [ & ] {
+		for (int i = 0; i < iterations; ++i)
+		{
+			group.forEach([ ] ( Position& position, const Velocity& velocity ) {
+				position.x += velocity.dx;
+				position.y += velocity.dy;
+			});
+		}
+	});
+	doNotOptimize(groupMgr.getComponents<Position>());
+
+	measure("Position view excluding Static", entityCount * iterations, [ & ] {
+		for (int i = 0; i < iterations; ++i)
+		{
+			mgr.view<Position>(exclude<Static>).forEach([ ] ( Position& position ) {
+				position.x += 1.f;
+			});
+		}
+	});
+	doNotOptimize(mgr.getComponents<Position>());
+}
+
+void Bench::runParallelViewBenchmarks() {
+	constexpr std::size_t entityCount = 1'000'000;
+	constexpr int iterations = 10;
+
+	EntityManager mgr;
+	populate(mgr, entityCount);
+
+	const auto integrate = [ ] ( Position& position, const Velocity& velocity ) {
+		position.x += velocity.dx * 0.016f;
+		position.y += velocity.dy * 0.016f;
+	};
+
+	measure("1M Position+Velocity view, serial", entityCount * iterations, [ & ] {
+		for (int i = 0; i < iterations; ++i)
+			mgr.view<Position, Velocity>().forEach(integrate);
+	});
+	doNotOptimize(mgr.getComponents<Position>());
+
+	Utilities::ThreadPool threadPool;
+
+	measure("1M Position+Velocity view, parallel on " + std::to_string(threadPool.getThreadCount()) + " threads",
+			entityCount * iterations, [ & ] {
+		for (int i = 0; i < iterations; ++i)
+			mgr.view<Position, Velocity>().parallelForEach(threadPool, integrate);
+	});
+	doNotOptimize(mgr.getComponents<Position>());
+
+	measure("1M Position+Velocity view, parallel deterministic", entityCount * iterations, [ & ] {
+		for (int i = 0; i < iterations; ++i)
+			mgr.view<Position, Velocity>().parallelForEach(threadPool, integrate, { 0, true });
+	});
+	doNotOptimize(mgr.getComponents<Position>());
+}
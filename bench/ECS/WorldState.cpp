@@ -0,0 +1,61 @@
+#include "Benchmark.h"
+
+#include <string>
+
+#include "GameLibrary/ECS/Entity.h"
+#include "GameLibrary/ECS/EntityManager.h"
+#include "GameLibrary/ECS/WorldState.h"
+
+using namespace GameLibrary;
+using namespace GameLibrary::ECS;
+
+
+namespace
+{
+	struct Position {
+		float x = 0.f; float y = 0.f;
+	};
+	struct Velocity {
+		float dx = 1.f; float dy = 1.f;
+	};
+	struct Static {};
+
+	struct MovingEntity : BaseEntity<Position, Velocity> {};
+	struct StaticEntity : BaseEntity<Position, Static> {};
+
+	using History = WorldStateHistory<Position, Velocity, Static>;
+}
+
+
+void Bench::runWorldStateBenchmarks() {
+	constexpr int iterations = 100;
+	// Rollback netcode keeps about a second of frames.
+	constexpr std::size_t frameCount = 64;
+
+	for (const std::size_t entityCount : { 1'000, 10'000, 100'000 })
+	{
+		EntityManager mgr;
+		mgr.addEntities<MovingEntity>(entityCount / 2);
+		mgr.addEntities<StaticEntity>(entityCount / 2);
+
+		History history(frameCount);
+		const auto label = std::to_string(entityCount) + " entities";
+
+		// First lap of the ring allocates, later ones reuse buffers.
+		for (History::Frame frame = 0; frame < frameCount; ++frame)
+			history.capture(mgr, frame);
+
+		const auto captureTime = measure(label + ", capture", iterations, [ & ] {
+			for (History::Frame frame = 0; frame < iterations; ++frame)
+				history.capture(mgr, frameCount + frame);
+		});
+
+		const auto restoreTime = measure(label + ", restore", iterations, [ & ] {
+			for (History::Frame frame = 0; frame < iterations; ++frame)
+				history.restore(mgr, frameCount + iterations - 1 - frame % frameCount);
+		});
+		doNotOptimize(mgr.getComponents<Position>());
+
+		std::cout << label << ": " << (captureTime / entityCount) << " / " << (restoreTime / entityCount) << " ns per entity (capture / restore)\n";
+	}
+}
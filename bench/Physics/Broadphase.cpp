@@ -0,0 +1,104 @@
+#include "Benchmark.h"
+
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <string>
+
+#include "GameLibrary/ECS/EntityManager.h"
+#include "GameLibrary/Physics/Collider.h"
+#include "GameLibrary/Physics/DynamicAabbTree.h"
+#include "GameLibrary/Physics/SweepAndPrune.h"
+
+using namespace GameLibrary;
+using namespace GameLibrary::ECS;
+using namespace GameLibrary::Physics;
+
+
+namespace
+{
+	struct Velocity {
+		float dx = 0.f; float dy = 0.f;
+	};
+
+	constexpr int frames = 10;
+	constexpr float boxSize = 1.0f;
+
+	// Every movingEvery-th box moves, others are static.
+	void populate(EntityManager& mgr, const std::size_t boxCount, const std::size_t movingEvery) {
+		// World sized for ~10% of area covered by boxes, whatever their count.
+		const auto worldSize = std::sqrt(static_cast<float>(boxCount) * boxSize * boxSize * 10.0f);
+
+		std::mt19937 random(42);
+		std::uniform_real_distribution<float> coordinate(0.0f, worldSize);
+		std::uniform_real_distribution<float> speed(-0.2f, 0.2f);
+
+		for (std::size_t i = 0; i < boxCount; ++i)
+		{
+			const auto id = mgr.createEntity();
+			const auto x = coordinate(random), y = coordinate(random);
+
+			const auto isMoving = (i % movingEvery == 0);
+
+			mgr.addComponent<Collider>(id, Collider{ { x, y, x + boxSize, y + boxSize }, !isMoving });
+			if (isMoving)
+				mgr.addComponent<Velocity>(id, speed(random), speed(random));
+		}
+	}
+
+	void move(EntityManager& mgr) {
+		mgr.view<Collider, Velocity>().forEach([ &mgr ] ( const EntityId id, Collider& collider, const Velocity& velocity ) {
+			auto& bounds = collider.bounds;
+			bounds = { bounds.minX + velocity.dx, bounds.minY + velocity.dy, bounds.maxX + velocity.dx, bounds.maxY + velocity.dy };
+			mgr.markComponentChanged<Collider>(id);
+		});
+	}
+
+	void reportPairsPerSecond(const std::string& name, const double nanosecondsPerFrame, const std::size_t pairsPerFrame) {
+		std::cout << name << ": " << static_cast<double>(pairsPerFrame) / (nanosecondsPerFrame * 1e-9) << " pairs/s ("
+				  << pairsPerFrame << " pairs/frame)\n";
+	}
+
+	void runFor(const std::size_t boxCount, const std::size_t movingEvery) {
+		const auto suffix = " (" + std::to_string(boxCount) + " boxes, " + std::to_string(boxCount / movingEvery) + " moving)";
+		EntityManager mgr;
+		PairBuffer pairs;
+		populate(mgr, boxCount, movingEvery);
+
+		SweepAndPrune sweepAndPrune;
+		const auto sweepAndPruneTime = Bench::measure("SweepAndPrune frame" + suffix, frames, [ & ] {
+			for (int frame = 0; frame < frames; ++frame)
+			{
+				move(mgr);
+				sweepAndPrune.findPairs(mgr, pairs);
+			}
+		});
+		reportPairsPerSecond("SweepAndPrune" + suffix, sweepAndPruneTime, pairs.size());
+
+		DynamicAabbTree tree;
+		tree.update(mgr, 0);
+
+		ChangeTick since = mgr.advanceChangeTick();
+		const auto treeTime = Bench::measure("DynamicAabbTree frame" + suffix, frames, [ & ] {
+			for (int frame = 0; frame < frames; ++frame)
+			{
+				move(mgr);
+
+				const auto previous = since;
+				since = mgr.advanceChangeTick();
+				tree.update(mgr, previous);
+				tree.findPairs(pairs);
+			}
+		});
+		reportPairsPerSecond("DynamicAabbTree" + suffix, treeTime, pairs.size());
+	}
+}
+
+
+void Bench::runBroadphaseBenchmarks() {
+	for (const std::size_t boxCount : { 10'000, 100'000 })
+	{
+		runFor(boxCount, 1);
+		runFor(boxCount, 10);
+	}
+}
@@ -0,0 +1,93 @@
+#include "Benchmark.h"
+
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace GameLibrary;
+
+
+namespace
+{
+	using Suite = std::pair<const char*, void (*)()>;
+
+	const std::vector<Suite> suites = {
+		{ "entitymanager", Bench::runEntityManagerBenchmarks },
+		{ "view", Bench::runViewBenchmarks },
+		{ "parallelview", Bench::runParallelViewBenchmarks },
+		{ "staticworld", Bench::runStaticWorldBenchmarks },
+		{ "snapshot", Bench::runSnapshotBenchmarks },
+		{ "worldstate", Bench::runWorldStateBenchmarks },
+		{ "transformhierarchy", Bench::runTransformHierarchyBenchmarks },
+		{ "resources", Bench::runResourceBenchmarks },
+		{ "broadphase", Bench::runBroadphaseBenchmarks }
+	};
+
+	void printUsage() {
+		std::cout << "Usage: GameLibraryBench [--json <path>] [suite...]\n\nSuites (all by default):";
+		for (const auto& [name, _] : suites)
+			std::cout << ' ' << name;
+		std::cout << '\n';
+	}
+}
+
+
+/*
+ *  Runs selected benchmark suites, optionally writing results to a JSON file, so runs can be compared by a script.
+ *  Inputs are generated from fixed seeds - runs differ only by timing.
+ */
+int main(int argc, char* argv[]) {
+	std::string jsonPath;
+	std::vector<std::string> selected;
+
+	for (int i = 1; i < argc; ++i)
+	{
+		const std::string argument = argv[i];
+
+		if (argument == "--json" && i + 1 < argc)
+			jsonPath = argv[++i];
+		else if (argument == "--help" || argument == "-h" || argument.rfind("--", 0) == 0)
+		{
+			printUsage();
+			return (argument == "--help" || argument == "-h") ? 0 : 1;
+		}
+		else
+			selected.emplace_back(argument);
+	}
+
+	for (const auto& name : selected)
+	{
+		if (std::find_if(std::cbegin(suites), std::cend(suites), [ &name ] ( const Suite& suite ) { return name == suite.first; }) == std::cend(suites))
+		{
+			std::cerr << "Unknown suite: " << name << "\n";
+			printUsage();
+			return 1;
+		}
+	}
+
+	for (const auto& [name, run] : suites)
+	{
+		if (selected.empty() || std::find(std::cbegin(selected), std::cend(selected), name) != std::cend(selected))
+		{
+			std::cout << "== " << name << " ==\n";
+			run();
+		}
+	}
+
+	if (!jsonPath.empty())
+	{
+		std::ofstream file(jsonPath);
+		if (!file)
+		{
+			std::cerr << "Couldn't write " << jsonPath << "\n";
+			return 1;
+		}
+
+		Bench::writeJson(file, Bench::getResults());
+	}
+
+	return 0;
+}
@@ -0,0 +1,337 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "GameLibrary/ECS/Component.h"
+#include "GameLibrary/ECS/EntityId.h"
+#include "GameLibrary/ECS/EntityManager.h"
+#include "GameLibrary/Exceptions/Standard.h"
+
+
+namespace GameLibrary::ECS
+{
+	/*
+	 *  BasicEntityCommandBuffer: Records structural changes (creating / destroying entities, adding / removing components),
+	 *  						  and applies them to Manager later - e.g. after iteration of a View has finished.
+	 *
+	 *  						  Commands are grouped by kind and component type, and played back in batches:
+	 *  						  entity creations first, then component additions and removals (per type, sorted by entity),
+	 *  						  then entity destructions. Additions and removals of a type on the same entity are applied
+	 *  						  in order of recording. Commands on entities which don't exist at playback are ignored.
+	 *
+	 *  						  Created entities start empty and receive their components one type at a time, so with
+	 *  						  ArchetypeStorage an entity created with K components moves between archetypes K times -
+	 *  						  playback isn't a single bulk move per entity there.
+	 */
+	template<typename Manager>
+	class BasicEntityCommandBuffer
+	{
+		/*
+		 *  BaseComponentCommands: Type-erased interface of ComponentCommands<C>.
+		 */
+		class BaseComponentCommands
+		{
+		public:
+			virtual ~BaseComponentCommands() = default;
+
+			virtual void playback(Manager& mgr, const std::vector<EntityId>& created) = 0;
+			virtual void append(BaseComponentCommands& other, EntityId::Index placeholderOffset) = 0;
+			virtual bool isEmpty() const = 0;
+			virtual void clear() = 0;
+			virtual std::unique_ptr<BaseComponentCommands> makeEmpty() const = 0;
+		};
+
+		template<typename C>
+		class ComponentCommands : public BaseComponentCommands
+		{
+		public:
+			// Addition of component, or removal if component is empty.
+			struct Command {
+				EntityId		 id;
+				std::optional<C> component;
+			};
+
+			virtual void playback(Manager& mgr, const std::vector<EntityId>& created) override {
+				std::size_t additionCount = 0;
+				for (auto& command : commands)
+				{
+					command.id = resolve(command.id, created);
+					additionCount += command.component ? 1 : 0;
+				}
+
+				// Stable sort keeps recording order of commands on the same entity, e.g. removal followed by re-addition.
+				std::stable_sort(std::begin(commands), std::end(commands), [ ] ( const Command& lhs, const Command& rhs ) {
+					return lhs.id.getIndex() < rhs.id.getIndex();
+				});
+
+				mgr.template reserveComponents<C>(additionCount);
+
+				for (auto& command : commands)
+				{
+					if (!mgr.entityExists(command.id))
+						continue;
+
+					if (command.component)
+						mgr.template addComponent<C>(command.id, std::move(*command.component));
+					else
+						mgr.template removeComponent<C>(command.id);
+				}
+
+				clear();
+			}
+
+			virtual void append(BaseComponentCommands& other, const EntityId::Index placeholderOffset) override {
+				auto& otherCommands = static_cast<ComponentCommands<C>&>(other).commands;
+
+				for (auto& command : otherCommands)
+					commands.push_back({ offsetPlaceholder(command.id, placeholderOffset), std::move(command.component) });
+
+				other.clear();
+			}
+
+			virtual bool isEmpty() const override {
+				return commands.empty();
+			}
+
+			virtual void clear() override {
+				commands.clear();
+			}
+
+			virtual std::unique_ptr<BaseComponentCommands> makeEmpty() const override {
+				return std::make_unique<ComponentCommands<C>>();
+			}
+
+			// In order of recording.
+			std::vector<Command> commands;
+		};
+
+	public:
+		/*
+		 *  createEntity(): Record creation of an entity, and return its placeholder handle.
+		 *
+		 *  				Placeholder can be passed to other commands of this buffer, and is replaced by the real handle at playback.
+		 *  				It doesn't refer to an entity anywhere else.
+		 */
+		EntityId createEntity() {
+			return EntityId(_createdCount++, EntityId::placeholderGeneration);
+		}
+
+		/*
+		 *  removeEntity(): Record destruction of entity.
+		 */
+		void removeEntity(const EntityId id) {
+			_removedEntities.emplace_back(id);
+		}
+
+		/*
+		 *  addComponent(): Record addition of component of type C, constructed from ctorArgs right away.
+		 *  				Has no effect at playback if entity already has one.
+		 */
+		template<typename C, typename... Args>
+		void addComponent(const EntityId id, Args&&... ctorArgs) {
+			getCommands<C>().commands.push_back({ id, makeComponent<C>(std::forward<Args>(ctorArgs)...) });
+		}
+
+		/*
+		 *  removeComponent(): Record removal of entity's component of type C.
+		 */
+		template<typename C>
+		void removeComponent(const EntityId id) {
+			getCommands<C>().commands.push_back({ id, std::nullopt });
+		}
+
+		/*
+		 *  append(): Move all commands of other buffer to the end of this one, keeping its placeholders distinct from ours.
+		 */
+		void append(BasicEntityCommandBuffer& other) {
+			const auto placeholderOffset = _createdCount;
+
+			if (_componentCommands.size() < other._componentCommands.size())
+				_componentCommands.resize(other._componentCommands.size());
+
+			for (std::size_t index = 0; index < other._componentCommands.size(); ++index)
+			{
+				const auto& commands = other._componentCommands[index];
+				if (!commands)
+					continue;
+
+				if (!_componentCommands[index])
+					_componentCommands[index] = commands->makeEmpty();
+
+				_componentCommands[index]->append(*commands, placeholderOffset);
+			}
+
+			for (const auto id : other._removedEntities)
+				_removedEntities.emplace_back(offsetPlaceholder(id, placeholderOffset));
+
+			_createdCount += other._createdCount;
+			other.clear();
+		}
+
+		/*
+		 *  playback(): Apply all recorded commands to mgr, and clear the buffer.
+		 *
+		 *  Returns:
+		 *    - Handles of created entities, in order of their createEntity() calls.
+		 */
+		std::vector<EntityId> playback(Manager& mgr) {
+			std::vector<EntityId> created;
+			created.reserve(_createdCount);
+
+			for (EntityId::Index index = 0; index < _createdCount; ++index)
+				created.emplace_back(mgr.createEntity());
+
+			for (auto& commands : _componentCommands)
+			{
+				if (commands)
+					commands->playback(mgr, created);
+			}
+
+			for (auto& id : _removedEntities)
+				id = resolve(id, created);
+			std::sort(std::begin(_removedEntities), std::end(_removedEntities));
+
+			for (const auto id : _removedEntities)
+				mgr.removeEntity(id);
+
+			clear();
+
+			return created;
+		}
+
+		bool isEmpty() const {
+			return (_createdCount == 0) && _removedEntities.empty()
+					&& std::all_of(std::cbegin(_componentCommands), std::cend(_componentCommands), [] ( const auto& commands ) {
+						return !commands || commands->isEmpty();
+					});
+		}
+
+		/*
+		 *  clear(): Drop all recorded commands. Keeps allocated memory, so recording the next frame doesn't allocate again.
+		 */
+		void clear() {
+			for (auto& commands : _componentCommands)
+			{
+				if (commands)
+					commands->clear();
+			}
+
+			_removedEntities.clear();
+			_createdCount = 0;
+		}
+
+	private:
+		static EntityId resolve(const EntityId id, const std::vector<EntityId>& created) {
+			if (!id.isPlaceholder())
+				return id;
+
+			if (id.getIndex() >= created.size())
+				throw Exceptions::InvalidArgument("ECS::EntityCommandBuffer::playback() failed: Placeholder handle doesn't belong to this buffer.");
+
+			return created[id.getIndex()];
+		}
+
+		static EntityId offsetPlaceholder(const EntityId id, const EntityId::Index offset) {
+			return id.isPlaceholder() ? EntityId(id.getIndex() + offset, EntityId::placeholderGeneration) : id;
+		}
+
+		template<typename C>
+		ComponentCommands<C>& getCommands() {
+			const auto index = componentIndex<C>();
+
+			if (index >= _componentCommands.size())
+				_componentCommands.resize(index + 1);
+
+			auto& commands = _componentCommands[index];
+			if (!commands)
+				commands = std::make_unique<ComponentCommands<C>>();
+
+			return static_cast<ComponentCommands<C>&>(*commands);
+		}
+
+		std::vector<std::unique_ptr<BaseComponentCommands>> _componentCommands;
+		std::vector<EntityId>								_removedEntities;
+		EntityId::Index										_createdCount = 0;
+	};
+
+	/*
+	 *  BasicParallelCommandBuffer: Set of BasicEntityCommandBuffers, one per recording thread, so systems running on
+	 *  							ThreadPool workers can record commands without locking each other
+	 *  							(a thread locks only when it gets its buffer for the first time).
+	 *
+	 *  							playback() merges all buffers into one, and applies it in a single batched pass.
+	 */
+	template<typename Manager>
+	class BasicParallelCommandBuffer
+	{
+	public:
+		using Buffer = BasicEntityCommandBuffer<Manager>;
+
+		/*
+		 *  getLocal(): Return buffer of calling thread, creating it on first use.
+		 *  			Returned buffer must only be used by the calling thread.
+		 *
+		 *  			Each thread caches the buffer it got last, so repeated calls from a thread don't lock.
+		 */
+		Buffer& getLocal() {
+			// Keyed on instance id rather than address, which a later ParallelCommandBuffer might reuse.
+			thread_local std::uint64_t cachedInstance = 0;
+			thread_local Buffer* cachedBuffer = nullptr;
+
+			if (cachedInstance == _instanceId)
+				return *cachedBuffer;
+
+			const auto threadId = std::this_thread::get_id();
+			std::lock_guard lock(_mutex);
+
+			auto buffer = std::find_if(std::begin(_buffers), std::end(_buffers), [ threadId ] ( const auto& entry ) {
+				return entry.first == threadId;
+			});
+			if (buffer == std::end(_buffers))
+				buffer = _buffers.emplace(std::end(_buffers), threadId, std::make_unique<Buffer>());
+
+			cachedInstance = _instanceId;
+			cachedBuffer = buffer->second.get();
+
+			return *cachedBuffer;
+		}
+
+		/*
+		 *  playback(): Apply commands of all threads to mgr, and clear all buffers. Must not run concurrently with recording.
+		 *
+		 *  Returns:
+		 *    - Handles of created entities, grouped by recording thread (in order threads first recorded).
+		 */
+		std::vector<EntityId> playback(Manager& mgr) {
+			std::lock_guard lock(_mutex);
+
+			for (auto& [_, buffer] : _buffers)
+				_merged.append(*buffer);
+
+			return _merged.playback(mgr);
+		}
+
+	private:
+		static std::uint64_t makeInstanceId() {
+			static std::atomic<std::uint64_t> counter{1};
+			return counter++;
+		}
+
+		// Unique across all instances ever created, never 0.
+		const std::uint64_t												_instanceId = makeInstanceId();
+		std::mutex														_mutex;
+		std::vector<std::pair<std::thread::id, std::unique_ptr<Buffer>>>	_buffers;
+		Buffer															_merged;
+	};
+
+	using EntityCommandBuffer = BasicEntityCommandBuffer<EntityManager>;
+	using ParallelCommandBuffer = BasicParallelCommandBuffer<EntityManager>;
+}
@@ -1,10 +1,84 @@
 #pragma once
 
+#include <atomic>
+#include <cstddef>
+#include <new>
+#include <string>
+#include <type_traits>
+#include <typeinfo>
+#include <utility>
+
+#include <boost/core/demangle.hpp>
+
+#include "GameLibrary/Exceptions/Standard.h"
+
 
 namespace GameLibrary::ECS
 {
-	struct BaseComponent { 
-		virtual ~BaseComponent() = default;
-	};
-}
+	/*
+	 *  BaseComponent: Optional, empty base of components.
+	 *
+	 *  			   Components may be any move-constructible and move-assignable type (e.g. plain aggregates).
+	 *  			   Storages keep components by value, with type erasure done per pool - so no virtual destructor is needed.
+	 */
+	struct BaseComponent {};
+
+	/*
+	 *  constructComponent(): Construct C in place from ctorArgs - using brace initialization for aggregates, so plain structs
+	 *  					  can be initialized memberwise.
+	 */
+	template<typename C, typename... Args>
+	C* constructComponent(void* place, Args&&... ctorArgs) {
+		if constexpr (std::is_aggregate_v<C>)
+			return new (place) C{ std::forward<Args>(ctorArgs)... };
+		else
+			return new (place) C(std::forward<Args>(ctorArgs)...);
+	}
+
+	template<typename C, typename... Args>
+	C makeComponent(Args&&... ctorArgs) {
+		if constexpr (std::is_aggregate_v<C>)
+			return C{ std::forward<Args>(ctorArgs)... };
+		else
+			return C(std::forward<Args>(ctorArgs)...);
+	}
 
+	/*
+	 *  maxComponentTypes: Limit of distinct types getting a componentIndex() in a process - components, and Resource<T> markers
+	 *  				   declared in Scheduler. Sized so entity signatures (ComponentMask) are fixed-size, allocation-free bitsets.
+	 */
+	inline constexpr std::size_t maxComponentTypes = 256;
+
+	/*
+	 *  componentIndex(): Return process-wide index of component type C.
+	 *
+	 *  				  Indices are assigned sequentially on first use, so they can index plain arrays instead of maps keyed by typeid.
+	 *
+	 *  Throws:
+	 *    - OverflowError if maxComponentTypes types already have an index.
+	 */
+	inline std::size_t nextComponentIndex() {
+		static std::atomic<std::size_t> counter{0};
+
+		const auto index = counter++;
+		if (index >= maxComponentTypes)
+			throw Exceptions::OverflowError("ECS::componentIndex() failed: Count of component types exceeds maxComponentTypes.");
+
+		return index;
+	}
+
+	template<typename C>
+	std::size_t componentIndex() {
+		static const std::size_t index = nextComponentIndex();
+		return index;
+	}
+
+	/*
+	 *  componentName(): Return readable name of component type C (demangled where the compiler supports it), for diagnostics.
+	 */
+	template<typename C>
+	const std::string& componentName() {
+		static const std::string name = boost::core::demangle(typeid(C).name());
+		return name;
+	}
+}
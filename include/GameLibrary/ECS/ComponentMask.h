@@ -0,0 +1,138 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "GameLibrary/ECS/Component.h"
+#include "GameLibrary/ECS/Exclude.h"
+#include "GameLibrary/Exceptions/Standard.h"
+
+
+namespace GameLibrary::ECS
+{
+	/*
+	 *  ComponentMask: Fixed-size bitset of component types, bit i standing for type with componentIndex() i.
+	 *
+	 *  			   Used as entity's signature (types it has), and in queries (types required / excluded),
+	 *  			   so matching a query is a few word-wide AND / compare operations regardless of count of types.
+	 */
+	class ComponentMask
+	{
+	public:
+		using Word = std::uint64_t;
+
+		static constexpr std::size_t capacity = maxComponentTypes;
+		static constexpr std::size_t wordBits = 64;
+
+		/*
+		 *  of(): Return mask of Cs... component types. Computed once per type list.
+		 */
+		template<typename... Cs>
+		static const ComponentMask& of() {
+			static const ComponentMask mask = [ ] {
+				ComponentMask result;
+				(result.set(componentIndex<Cs>()), ...);
+
+				return result;
+			}();
+
+			return mask;
+		}
+
+		/*
+		 *  set(): Set bit of component type index.
+		 *
+		 *  Throws:
+		 *    - OverflowError if index doesn't fit in the mask.
+		 */
+		void set(const std::size_t index) {
+			if (index >= capacity)
+				throw Exceptions::OverflowError("ECS::ComponentMask::set() failed: Component index exceeds mask capacity.");
+
+			_words[index / wordBits] |= Word(1) << (index % wordBits);
+		}
+
+		void reset(const std::size_t index) {
+			if (index < capacity)
+				_words[index / wordBits] &= ~(Word(1) << (index % wordBits));
+		}
+
+		bool test(const std::size_t index) const {
+			return (index < capacity) && (_words[index / wordBits] & (Word(1) << (index % wordBits)));
+		}
+
+		void clear() {
+			_words.fill(0);
+		}
+
+		bool none() const {
+			for (const auto word : _words)
+			{
+				if (word != 0)
+					return false;
+			}
+
+			return true;
+		}
+
+		/*
+		 *  containsAll(): Check if all bits set in other are set in this mask.
+		 */
+		bool containsAll(const ComponentMask& other) const {
+			for (std::size_t i = 0; i < _words.size(); ++i)
+			{
+				if ((_words[i] & other._words[i]) != other._words[i])
+					return false;
+			}
+
+			return true;
+		}
+
+		bool intersects(const ComponentMask& other) const {
+			for (std::size_t i = 0; i < _words.size(); ++i)
+			{
+				if (_words[i] & other._words[i])
+					return true;
+			}
+
+			return false;
+		}
+
+		bool operator== (const ComponentMask& other) const {
+			return _words == other._words;
+		}
+
+		bool operator!= (const ComponentMask& other) const {
+			return _words != other._words;
+		}
+
+	private:
+		std::array<Word, capacity / wordBits> _words{};
+	};
+
+	/*
+	 *  ComponentQuery: Component types an entity must have, and ones it must not have, compiled into masks.
+	 *
+	 *  				Example: const auto& query = ComponentQuery::of<Position, Velocity>(exclude<Dead>);
+	 *  						 if (query.matches(mgr.getSignature(id))) ...
+	 */
+	struct ComponentQuery {
+		ComponentMask required;
+		ComponentMask excluded;
+
+		/*
+		 *  of(): Return query for entities having all of Cs... and none of Es... components. Computed once per type lists.
+		 */
+		template<typename... Cs, typename... Es>
+		static const ComponentQuery& of(Exclude<Es...> = {}) {
+			static const ComponentQuery query{ ComponentMask::of<Cs...>(), ComponentMask::of<Es...>() };
+
+			return query;
+		}
+
+		bool matches(const ComponentMask& signature) const {
+			return signature.containsAll(required) && !signature.intersects(excluded);
+		}
+	};
+}
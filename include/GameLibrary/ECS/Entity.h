@@ -1,6 +1,8 @@
 #pragma once
 
+#include <cstddef>
 #include <tuple>
+#include <type_traits>
 
 
 namespace GameLibrary::ECS
@@ -9,5 +11,16 @@ namespace GameLibrary::ECS
 	struct BaseEntity {
 		using ComponentsTuple = std::tuple<Components...>;
 	};
-}
 
+	/*
+	 *  makeEntityComponents(): Return components of i-th entity of a batch - result of init(i) if init is a generator,
+	 *  						otherwise a copy of init as prototype.
+	 */
+	template<typename ComponentsTuple, typename Init>
+	ComponentsTuple makeEntityComponents(Init& init, const std::size_t i) {
+		if constexpr (std::is_invocable_v<Init&, std::size_t>)
+			return init(i);
+		else
+			return ComponentsTuple(init);
+	}
+}
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+
+namespace GameLibrary::ECS
+{
+	/*
+	 *  EntityId: Versioned entity handle - slot index and slot's generation, packed into 64 bits.
+	 *
+	 *  		  Generation is bumped every time a slot is freed, so handles to destroyed entities never match a live entity
+	 *  		  reusing their slot. Default-constructed EntityId is null, and never refers to an entity.
+	 */
+	class EntityId
+	{
+	public:
+		using Index = std::uint32_t;
+		using Generation = std::uint32_t;
+		using Value = std::uint64_t;
+
+		// Never given to live entities - marks placeholder handles of entities which will be created later (e.g. by EntityCommandBuffer).
+		static constexpr Generation placeholderGeneration = static_cast<Generation>(-1);
+
+		constexpr EntityId() noexcept : _value(nullValue) {}
+		constexpr EntityId(const Index index, const Generation generation) noexcept
+				: _value((static_cast<Value>(generation) << 32) | index) {}
+
+		static constexpr EntityId fromValue(const Value value) noexcept {
+			return EntityId(static_cast<Index>(value), static_cast<Generation>(value >> 32));
+		}
+
+		constexpr Index getIndex() const noexcept {
+			return static_cast<Index>(_value);
+		}
+
+		constexpr Generation getGeneration() const noexcept {
+			return static_cast<Generation>(_value >> 32);
+		}
+
+		constexpr Value getValue() const noexcept {
+			return _value;
+		}
+
+		constexpr bool isNull() const noexcept {
+			return _value == nullValue;
+		}
+
+		constexpr bool isPlaceholder() const noexcept {
+			return !isNull() && getGeneration() == placeholderGeneration;
+		}
+
+		constexpr bool operator== (const EntityId other) const noexcept {
+			return _value == other._value;
+		}
+
+		constexpr bool operator!= (const EntityId other) const noexcept {
+			return _value != other._value;
+		}
+
+		constexpr bool operator< (const EntityId other) const noexcept {
+			return _value < other._value;
+		}
+
+	private:
+		static constexpr Value nullValue = static_cast<Value>(-1);
+
+		Value _value;
+	};
+
+	/*
+	 *  getEntityIndex(): Return position of entity in dense per-entity arrays (e.g. sparse sets).
+	 */
+	constexpr std::size_t getEntityIndex(const EntityId id) noexcept {
+		return id.getIndex();
+	}
+}
+
+template<>
+struct std::hash<GameLibrary::ECS::EntityId> {
+	std::size_t operator() (const GameLibrary::ECS::EntityId id) const noexcept {
+		return std::hash<GameLibrary::ECS::EntityId::Value>()(id.getValue());
+	}
+};
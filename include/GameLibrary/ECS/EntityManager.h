@@ -1,96 +1,545 @@
 #pragma once
 
-#include <map>
-#include <memory>
+#include <algorithm>
+#include <array>
+#include <cstdint>
 #include <tuple>
-#include <typeindex>
+#include <type_traits>
+#include <vector>
 
 #include <boost/mp11.hpp>
 
 #include "GameLibrary/ECS/Component.h"
-#include "GameLibrary/Utilities/IdManager.h"
+#include "GameLibrary/ECS/ComponentMask.h"
+#include "GameLibrary/ECS/Entity.h"
+#include "GameLibrary/ECS/EntityId.h"
+#include "GameLibrary/ECS/EntityTable.h"
+#include "GameLibrary/ECS/MemoryStats.h"
+#include "GameLibrary/ECS/Observers.h"
+#include "GameLibrary/ECS/Resources.h"
+#include "GameLibrary/ECS/Storage/ArchetypeStorage.h"
+#include "GameLibrary/ECS/Storage/MapStorage.h"
+#include "GameLibrary/ECS/Storage/SparseSetStorage.h"
+#include "GameLibrary/ECS/View.h"
+#include "GameLibrary/Event/Dispatcher.h"
+#include "GameLibrary/Exceptions/Standard.h"
 
 
 namespace GameLibrary::ECS
 {
-	class EntityManager
+	template<typename... Components>
+	class Snapshot;
+
+	template<typename... Components>
+	class WorldState;
+
+	/*
+	 *  BasicEntityManager: Creates entities, and manages their components through Storage backend.
+	 *
+	 *  					Storage decides memory layout of components - refer to EntityManager / MapEntityManager / ArchetypeEntityManager aliases.
+	 *  					Each entity carries a ComponentMask of its component types (signature), so checking components
+	 *  					and matching queries doesn't touch storage. Changes made directly through getStorage() bypass signatures.
+	 *  					Signatures are fixed-size, so a process may use at most maxComponentTypes component types (with every
+	 *  					Storage) - componentIndex() throws OverflowError beyond that.
+	 */
+	template<typename Storage>
+	class BasicEntityManager
 	{
-		using ComponentPtr = std::unique_ptr<BaseComponent>;
+		// Restore entity table and signatures along with components.
+		template<typename...>
+		friend class Snapshot;
+		template<typename...>
+		friend class WorldState;
 	public:
-		using Id = long long;
+		using Id = EntityId;
 
+		/*
+		 *  createEntity(): Return handle to a new entity without components.
+		 */
+		Id createEntity() {
+			const auto id = _entities.create();
+			signatureOf(id);
+
+			return id;
+		}
+
+		/*
+		 *  addEntity(): Create entity of type E with supplied components (default-constructed unless given).
+		 */
 		template<typename E>
-		Id addEntity() {
-			const auto id = _idMgr.get();
+		Id addEntity(typename E::ComponentsTuple components = {}) {
+			const auto id = _entities.create();
+
+			// Pass all of E::ComponentsTuple's components at once, so storage can place them together.
+			signatureOf(id) = maskOf<typename E::ComponentsTuple>();
 
-			// Call addComponent<C>() for each type of E::ComponentsTuple.
-			boost::mp11::tuple_for_each(typename E::ComponentsTuple(), [ this, id ] ( auto component ) { addComponent<decltype(component)>(id); });
+			std::apply([ this, id ] ( auto&&... components ) {
+				_storage.insert(id, std::move(components)...);
+				(_observers.template onAdded<std::decay_t<decltype(components)>>(id), ...);
+			}, std::move(components));
 
 			return id;
 		}
 
+		/*
+		 *  addEntities(): Create count entities of type E, reserving ids and component storage for all of them up front.
+		 *
+		 *  			   init is either a prototype E::ComponentsTuple copied into every entity,
+		 *  			   or a generator called as init(i) for i in [0, count), returning entity's E::ComponentsTuple.
+		 *
+		 *  			   Example: mgr.addEntities<Particle>(50000, [ & ] ( std::size_t i ) { return Particle::ComponentsTuple{ ... }; })
+		 *
+		 *  Returns:
+		 *    - Handles of created entities, in order of creation.
+		 */
+		template<typename E, typename Init = typename E::ComponentsTuple>
+		std::vector<Id> addEntities(const std::size_t count, Init&& init = {}) {
+			using ComponentsTuple = typename E::ComponentsTuple;
+
+			boost::mp11::mp_for_each<boost::mp11::mp_transform<boost::mp11::mp_identity, ComponentsTuple>>([ this, count ] ( auto type ) {
+				_storage.template reserve<typename decltype(type)::type>(count);
+			});
+
+			auto ids = _entities.create(count);
+
+			const auto& mask = maskOf<ComponentsTuple>();
+			_signatures.resize(std::max(_signatures.size(), _entities.getCapacity()));
+
+			for (std::size_t i = 0; i < count; ++i)
+			{
+				_signatures[ids[i].getIndex()] = mask;
+				std::apply([ this, id = ids[i] ] ( auto&&... components ) { _storage.insert(id, std::forward<decltype(components)>(components)...); },
+						makeEntityComponents<ComponentsTuple>(init, i));
+			}
+
+			boost::mp11::mp_for_each<boost::mp11::mp_transform<boost::mp11::mp_identity, ComponentsTuple>>([ this, &ids ] ( auto type ) {
+				_observers.template onAdded<typename decltype(type)::type>(ids);
+			});
+
+			return ids;
+		}
+
 		template<typename C>
 		bool entityHasComponent(const Id id) const {
-			const bool componentMapExists = (_components.find(typeid(C)) != std::cend(_components));
+			return _entities.isAlive(id) && _signatures[id.getIndex()].test(componentIndex<C>());
+		}
 
-			if (!componentMapExists)
-				return false;
+		/*
+		 *  getSignature(): Return mask of component types entity has. Empty for stale handles.
+		 */
+		const ComponentMask& getSignature(const Id id) const {
+			static const ComponentMask empty;
 
-			const auto& componentMap = _components.at(typeid(C));
+			return _entities.isAlive(id) ? _signatures[id.getIndex()] : empty;
+		}
 
-			return (componentMap.find(id) != std::cend(componentMap));
+		/*
+		 *  entityMatches(): Check if entity exists, and has all required and none of excluded components of query.
+		 */
+		bool entityMatches(const Id id, const ComponentQuery& query) const {
+			return _entities.isAlive(id) && query.matches(_signatures[id.getIndex()]);
 		}
 
-		bool entityExists(const Id id) const {
-			for (const auto& [_, componentMap] : _components)
+		/*
+		 *  forEachMatching(): Call func(id) for every live entity matching query, checking only entity signatures.
+		 *  				   Works with every Storage. func must not add or remove entities.
+		 *
+		 *  				   Example: mgr.forEachMatching(ComponentQuery::of<Position, Velocity>(exclude<Dead>), [ ] ( EntityId id ) { ... });
+		 */
+		template<typename F>
+		void forEachMatching(const ComponentQuery& query, F&& func) const {
+			for (const auto id : _entities.getAlive())
 			{
-				if (componentMap.find(id) != std::cend(componentMap))
-					return true;
+				if (query.matches(_signatures[id.getIndex()]))
+					func(id);
 			}
+		}
 
-			return false;
+		/*
+		 *  entityExists(): Check if id refers to a live entity. Handles to removed entities are never reported as existing,
+		 *  				even after their slot gets reused.
+		 */
+		bool entityExists(const Id id) const {
+			return _entities.isAlive(id);
 		}
 
+		/*
+		 *  getCount(): Return count of live entities, including ones without components.
+		 */
 		std::size_t getCount() const {
-			std::set<Id> foundIds;
+			return _entities.getAliveCount();
+		}
 
-			for (const auto& [_, componentMap] : _components)
-			{
-				for (const auto& [key, _] : componentMap)
-					foundIds.emplace(key);
-			}
+		/*
+		 *  getEntities(): Return packed list of live entities. Removing entities invalidates it, and changes its order.
+		 */
+		const std::vector<Id>& getEntities() const {
+			return _entities.getAlive();
+		}
 
-			return foundIds.size();
+		/*
+		 *  forEachEntity(): Call func(id) for every live entity, including ones without components.
+		 *  				 func must not add or remove entities.
+		 */
+		template<typename F>
+		void forEachEntity(F&& func) const {
+			for (const auto id : _entities.getAlive())
+				func(id);
+		}
+
+		/*
+		 *  getComponent(): Return reference to entity's component of type C.
+		 *  				Marks the component changed, if Storage tracks changes (SparseSetStorage).
+		 *
+		 *  Throws:
+		 *    - NotFoundError if entity doesn't have component C.
+		 */
+		template<typename C>
+		C& getComponent(const Id id) {
+			return _storage.template get<C>(id);
+		}
+
+		/*
+		 *  getComponent(): Return const reference to entity's component of type C, without marking it changed -
+		 *  				plain reads don't show up in changed() views, and systems declaring Reads<C> may call it concurrently.
+		 *
+		 *  				Example: std::as_const(mgr).getComponent<Velocity>(id)
+		 *
+		 *  Throws:
+		 *    - NotFoundError if entity doesn't have component C.
+		 */
+		template<typename C>
+		const C& getComponent(const Id id) const {
+			return _storage.template get<C>(id);
 		}
 
 		template<typename C>
 		auto& getComponents() {
-			if (_components.find(typeid(C)) != std::cend(_components))
-			{
-				return _components.at(typeid(C));
-			}
-			else
+			return _storage.template getComponents<C>();
+		}
+
+		/*
+		 *  view(): Return View of entities having all of Cs... components, and none of Es... components.
+		 *  		Supported by SparseSetStorage (default EntityManager).
+		 *
+		 *  		Example: mgr.view<Position, Velocity>(exclude<Dead>)
+		 */
+		template<typename... Cs, typename... Es>
+		auto view(Exclude<Es...> excluded = {}) {
+			return _storage.template view<Cs...>(excluded);
+		}
+
+		/*
+		 *  group(): Return Group of entities having all of Owned... components, whose pools are kept in lockstep,
+		 *  		 so the Group iterates them as parallel arrays. Supported by SparseSetStorage (default EntityManager).
+		 *
+		 *  		 Example: mgr.group<Position, Velocity, Mass>().forEach(...)
+		 *
+		 *  Throws:
+		 *    - InvalidArgument if any of Owned... pools is already owned by a different group.
+		 */
+		template<typename... Owned>
+		auto group() {
+			return _storage.template group<Owned...>();
+		}
+
+		/*
+		 *  forEach(): Call func(id, C1&, C2&, ...) for every entity having all of Cs... components.
+		 *  		   func must not add or remove components / entities.
+		 */
+		template<typename... Cs, typename F>
+		void forEach(F&& func) {
+			_storage.template forEach<Cs...>(std::forward<F>(func));
+		}
+
+		/*
+		 *  forEachTagged(): Call func(id) for every entity having all of Tags... and none of Es... tag components (see TagPool).
+		 *  				 Tag bitsets are combined a word (64 entities) at a time, so cost depends on highest entity index,
+		 *  				 not on count of tagged entities. Supported by SparseSetStorage (default EntityManager).
+		 *
+		 *  				 Example: mgr.forEachTagged<Enemy>(exclude<Dead>, [ ] ( EntityId id ) { ... });
+		 */
+		template<typename... Tags, typename... Es, typename F>
+		void forEachTagged(Exclude<Es...>, F&& func) {
+			static_assert(sizeof...(Tags) > 0, "ECS::EntityManager::forEachTagged(): At least one tag is required.");
+			static_assert((isTagComponent<Tags> && ...) && (isTagComponent<Es> && ...), "ECS::EntityManager::forEachTagged(): All components must be tags.");
+
+			using Word = std::uint64_t;
+
+			const std::array<const std::vector<Word>*, sizeof...(Tags)> required{ &_storage.template getPool<Tags>().getWords()... };
+			const std::array<const std::vector<Word>*, sizeof...(Es)> excluded{ &_storage.template getPool<Es>().getWords()... };
+
+			std::size_t wordCount = required[0]->size();
+			for (const auto* words : required)
+				wordCount = std::min(wordCount, words->size());
+
+			for (std::size_t w = 0; w < wordCount; ++w)
 			{
-				static std::map<Id, ComponentPtr> emptyMap;
-				return emptyMap;
+				auto word = ~Word(0);
+
+				for (const auto* words : required)
+					word &= (*words)[w];
+				for (const auto* words : excluded)
+					word &= (w < words->size()) ? ~(*words)[w] : ~Word(0);
+
+				forEachSetIndex(word, w * 64, [ this, &func ] ( const std::size_t index ) {
+					func(_entities.getHandle(static_cast<EntityId::Index>(index)));
+				});
 			}
 		}
 
+		template<typename... Tags, typename F>
+		void forEachTagged(F&& func) {
+			forEachTagged<Tags...>(Exclude<>(), std::forward<F>(func));
+		}
+
+		/*
+		 *  removeEntity(): Destroy entity's components and invalidate its handle. Has no effect on stale handles.
+		 */
 		void removeEntity(const Id id) {
-			for (auto& [_, idToComponentMap] : _components)
-				idToComponentMap.erase(id);
+			if (!_entities.isAlive(id))
+				return;
+
+			_observers.onEntityRemoved(_storage, id);
+			_storage.remove(id);
+			_signatures[id.getIndex()].clear();
+			_entities.destroy(id);
+		}
+
+		Storage& getStorage() {
+			return _storage;
+		}
+
+		/*
+		 *  getMemoryStats(): Return memory held by entity table and by each component pool - counts, bytes used / reserved
+		 *  				  and fragmentation, e.g. for setting memory budgets or spotting pools left oversized by a past peak.
+		 *  				  Walks pools once, not components. Supported by SparseSetStorage (default EntityManager).
+		 *
+		 *  				  Example: printMemoryStats(std::cout, mgr.getMemoryStats());
+		 */
+		MemoryStats getMemoryStats() const {
+			MemoryStats stats;
 
-			_idMgr.free(id);
+			stats.entities = _entities.getMemoryUsage();
+			addVectorUsage(stats.entities, _signatures);
+			stats.entitySlots = _entities.getCapacity();
+			stats.freeEntitySlots = _entities.getFreeIndices().size();
+			_storage.collectMemoryStats(stats);
+
+			return stats;
+		}
+
+		/*
+		 *  emplaceResource(): Construct world resource T (e.g. camera, time step) from ctorArgs, replacing existing one.
+		 *  				   Resources aren't attached to entities, and live in a slot table indexed by resourceIndex<T>().
+		 *
+		 *  Returns:
+		 *    - Reference to new resource.
+		 */
+		template<typename T, typename... Args>
+		T& emplaceResource(Args&&... ctorArgs) {
+			return _resources.template emplace<T>(std::forward<Args>(ctorArgs)...);
+		}
+
+		/*
+		 *  resource(): Return reference to world resource T. Constant time, without entity or component lookups.
+		 *
+		 *  Throws:
+		 *    - NotFoundError if there is no resource T.
+		 */
+		template<typename T>
+		T& resource() {
+			return _resources.template get<T>();
+		}
+
+		template<typename T>
+		const T& resource() const {
+			return _resources.template get<T>();
+		}
+
+		/*
+		 *  findResource(): Return pointer to world resource T, or nullptr if there is none.
+		 */
+		template<typename T>
+		T* findResource() {
+			return _resources.template find<T>();
+		}
+
+		template<typename T>
+		bool hasResource() const {
+			return _resources.template contains<T>();
+		}
+
+		template<typename T>
+		void removeResource() {
+			_resources.template remove<T>();
+		}
+
+		Resources& getResources() {
+			return _resources;
 		}
 
 	public:
+		/*
+		 *  addComponent(): Construct entity's component of type C from ctorArgs.
+		 *  				Has no effect if entity already has one.
+		 *
+		 *  Returns:
+		 *    - Reference to entity's component.
+		 *
+		 *  Throws:
+		 *    - NotFoundError if entity doesn't exist.
+		 */
+		template<typename C, typename... Args>
+		C& addComponent(const Id entity, Args&&... ctorArgs) {
+			if (!_entities.isAlive(entity))
+				throw Exceptions::NotFoundError("ECS::EntityManager::addComponent() failed: Entity doesn't exist.");
+
+			auto& signature = signatureOf(entity);
+
+			if (_observers.template isObserved<C>() && !signature.test(componentIndex<C>()))
+				_observers.template onAdded<C>(entity);
+
+			signature.set(componentIndex<C>());
+
+			return _storage.template add<C>(entity, std::forward<Args>(ctorArgs)...);
+		}
+
+		/*
+		 *  replaceComponent(): Replace entity's component of type C with one constructed from ctorArgs, or add it if entity has none.
+		 *
+		 *  Returns:
+		 *    - Reference to entity's component.
+		 *
+		 *  Throws:
+		 *    - NotFoundError if entity doesn't exist.
+		 */
+		template<typename C, typename... Args>
+		C& replaceComponent(const Id entity, Args&&... ctorArgs) {
+			if (!entityHasComponent<C>(entity))
+				return addComponent<C>(entity, std::forward<Args>(ctorArgs)...);
+
+			auto& component = _storage.template get<C>(entity);
+			component = makeComponent<C>(std::forward<Args>(ctorArgs)...);
+			_observers.template onReplaced<C>(entity);
+
+			return component;
+		}
+
+		/*
+		 *  observe(): Start collecting additions, replacements and removals of components of type C,
+		 *  		   to be dispatched as batched events by flushObservers().
+		 */
 		template<typename C>
-		void addComponent(const Id entity) {
-			_components[typeid(C)].try_emplace(entity, std::make_unique<C>());
+		void observe() {
+			_observers.template observe<C>();
 		}
 
-		std::map<std::type_index, std::map<Id, ComponentPtr>> _components;
-		Utilities::SequentialIdManager<Id> _idMgr{0, 1};
+		/*
+		 *  flushObservers(): Dispatch ComponentsAddedEvent<C>, ComponentsReplacedEvent<C> and ComponentsRemovedEvent<C>
+		 *  				  for every observed C, each carrying all affected entities since the last flush.
+		 *  				  Removed entities no longer exist when events are dispatched.
+		 *  				  Callbacks may change observed components - such changes are delivered by the next flush.
+		 */
+		void flushObservers(Event::Dispatcher& dispatcher) {
+			_observers.flush(dispatcher);
+		}
+
+		/*
+		 *  markComponentChanged(): Report entity's component of type C as changed, e.g. after writing it through a View.
+		 *  						Supported by SparseSetStorage (default EntityManager).
+		 */
+		template<typename C>
+		void markComponentChanged(const Id id) {
+			_storage.template markChanged<C>(id);
+		}
+
+		ChangeTick getChangeTick() const {
+			return _storage.getTick();
+		}
+
+		/*
+		 *  advanceChangeTick(): Start a new change tick, and return the previous one.
+		 *  					 Systems keep the returned tick, to later view only components changed after it.
+		 *
+		 *  					 Example: const auto since = _lastRun;
+		 *  							  _lastRun = mgr.advanceChangeTick();
+		 *  							  mgr.view<Position>().changed<Position>(since).forEach(...);
+		 */
+		ChangeTick advanceChangeTick() {
+			return _storage.advanceTick();
+		}
+
+		/*
+		 *  reserveComponents(): Make room for additional components of type C, if storage supports it.
+		 */
+		template<typename C>
+		void reserveComponents(const std::size_t additional) {
+			_storage.template reserve<C>(additional);
+		}
+
+		/*
+		 *  prepareComponents(): Create storage of component types Cs... up front. Resource<T> markers among them are skipped.
+		 *
+		 *  					 Storage is otherwise created on first access - including view() - which would race
+		 *  					 between systems viewing a fresh type concurrently. Scheduler::addSystem(mgr, ...) calls this.
+		 */
+		template<typename... Cs>
+		void prepareComponents() {
+			boost::mp11::mp_for_each<boost::mp11::mp_list<boost::mp11::mp_identity<Cs>...>>([ this ] ( auto type ) {
+				using C = typename decltype(type)::type;
+
+				if constexpr (!isResource<C>)
+					_storage.template prepare<C>();
+			});
+		}
+
+		/*
+		 *  removeComponent(): Destroy entity's component of type C. Has no effect if entity doesn't have one.
+		 */
+		template<typename C>
+		void removeComponent(const Id entity) {
+			if (!_entities.isAlive(entity))
+				return;
+
+			auto& signature = signatureOf(entity);
+
+			if (_observers.template isObserved<C>() && signature.test(componentIndex<C>()))
+				_observers.template onRemoved<C>(entity);
+
+			signature.reset(componentIndex<C>());
+			_storage.template removeComponent<C>(entity);
+		}
+
+	private:
+		template<typename Tuple>
+		static const ComponentMask& maskOf() {
+			return boost::mp11::mp_apply<MaskOf, Tuple>::get();
+		}
+
+		template<typename... Cs>
+		struct MaskOf {
+			static const ComponentMask& get() {
+				return ComponentMask::of<Cs...>();
+			}
+		};
+
+		ComponentMask& signatureOf(const Id id) {
+			if (id.getIndex() >= _signatures.size())
+				_signatures.resize(_entities.getCapacity());
+
+			return _signatures[id.getIndex()];
+		}
+
+		Storage						_storage;
+		EntityTable					_entities;
+		// Indexed by entity index, meaningful only for live slots.
+		std::vector<ComponentMask>	_signatures;
+		ComponentObservers<Storage>	_observers;
+		Resources					_resources;
 	};
-}
 
+	using EntityManager = BasicEntityManager<SparseSetStorage>;
+	using MapEntityManager = BasicEntityManager<MapStorage>;
+	using ArchetypeEntityManager = BasicEntityManager<ArchetypeStorage>;
+}
@@ -0,0 +1,203 @@
+#pragma once
+
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+#include "GameLibrary/ECS/EntityId.h"
+#include "GameLibrary/ECS/MemoryStats.h"
+#include "GameLibrary/Exceptions/Standard.h"
+
+
+namespace GameLibrary::ECS
+{
+	/*
+	 *  EntityTable: Dense table of entity slots, each holding its current generation.
+	 *
+	 *  			 Destroying an entity bumps its slot's generation and queues the slot for reuse,
+	 *  			 so checking whether a handle is alive is a single array load and comparison.
+	 *  			 Live entities are additionally kept in a packed list, so counting and iterating them doesn't scan free slots.
+	 */
+	class EntityTable
+	{
+	public:
+		/*
+		 *  create(): Return handle to a new entity, reusing most recently freed slot if there is one.
+		 *
+		 *  Throws:
+		 *    - OverflowError if all representable slot indices are in use.
+		 */
+		EntityId create() {
+			if (!_freeIndices.empty())
+			{
+				const auto index = _freeIndices.back();
+				_freeIndices.pop_back();
+
+				return pushAlive(EntityId(index, _generations[index]));
+			}
+
+			// Highest index is reserved, so no valid handle equals a null one.
+			if (_generations.size() >= std::numeric_limits<EntityId::Index>::max())
+				throw Exceptions::OverflowError("ECS::EntityTable::create() failed: No free entity slots.");
+
+			_generations.emplace_back(0);
+			_alivePositions.emplace_back(0);
+
+			return pushAlive(EntityId(static_cast<EntityId::Index>(_generations.size() - 1), 0));
+		}
+
+		/*
+		 *  create(): Return handles to count new entities, growing the table at most once.
+		 *
+		 *  Throws:
+		 *    - OverflowError if there aren't enough free slot indices. No entity is created in that case.
+		 */
+		std::vector<EntityId> create(const std::size_t count) {
+			const auto newSlotCount = (count > _freeIndices.size()) ? (count - _freeIndices.size()) : 0;
+
+			if (newSlotCount > std::numeric_limits<EntityId::Index>::max() - _generations.size())
+				throw Exceptions::OverflowError("ECS::EntityTable::create() failed: No free entity slots.");
+
+			_generations.reserve(_generations.size() + newSlotCount);
+			_alivePositions.reserve(_alivePositions.size() + newSlotCount);
+			_alive.reserve(_alive.size() + count);
+
+			std::vector<EntityId> ids;
+			ids.reserve(count);
+
+			for (std::size_t i = 0; i < count; ++i)
+				ids.emplace_back(create());
+
+			return ids;
+		}
+
+		bool isAlive(const EntityId id) const {
+			const auto index = id.getIndex();
+
+			return (index < _generations.size()) && (_generations[index] == id.getGeneration());
+		}
+
+		/*
+		 *  destroy(): Invalidate all handles to entity, and allow its slot to be reused. Has no effect on stale handles.
+		 *
+		 *  		   Generation wraps around after 2^32 - 1 reuses of a single slot (placeholder generation is skipped).
+		 */
+		void destroy(const EntityId id) {
+			if (!isAlive(id))
+				return;
+
+			auto& generation = _generations[id.getIndex()];
+			if (++generation == EntityId::placeholderGeneration)
+				generation = 0;
+			_freeIndices.emplace_back(id.getIndex());
+
+			// Fill the hole in packed list with its last entity.
+			const auto position = _alivePositions[id.getIndex()];
+			const auto last = _alive.back();
+
+			_alive[position] = last;
+			_alivePositions[last.getIndex()] = position;
+			_alive.pop_back();
+		}
+
+		/*
+		 *  getHandle(): Return handle of entity currently occupying slot index. Slot must exist.
+		 */
+		EntityId getHandle(const EntityId::Index index) const {
+			return EntityId(index, _generations[index]);
+		}
+
+		std::size_t getAliveCount() const {
+			return _alive.size();
+		}
+
+		/*
+		 *  getAlive(): Return packed list of live entities. Order changes when entities are destroyed.
+		 */
+		const std::vector<EntityId>& getAlive() const {
+			return _alive;
+		}
+
+		/*
+		 *  getCapacity(): Return count of slots ever created (live and free).
+		 */
+		std::size_t getCapacity() const {
+			return _generations.size();
+		}
+
+		/*
+		 *  getGenerations(): Return current generation of every slot, indexed by slot index.
+		 */
+		const std::vector<EntityId::Generation>& getGenerations() const {
+			return _generations;
+		}
+
+		/*
+		 *  getFreeIndices(): Return free slot indices, in order of freeing - last one is reused first.
+		 */
+		const std::vector<EntityId::Index>& getFreeIndices() const {
+			return _freeIndices;
+		}
+
+		/*
+		 *  getMemoryUsage(): Return memory held by the table. Free slots count as used - they keep their generation.
+		 */
+		MemoryUsage getMemoryUsage() const {
+			MemoryUsage usage{ "entities", getAliveCount() };
+
+			addVectorUsage(usage, _generations);
+			addVectorUsage(usage, _freeIndices);
+			addVectorUsage(usage, _alive);
+			addVectorUsage(usage, _alivePositions);
+
+			return usage;
+		}
+
+		/*
+		 *  restore(): Replace table's content with slots previously read by getGenerations() and getFreeIndices().
+		 *  		   Slots not listed as free are alive, under their generation.
+		 *
+		 *  Throws:
+		 *    - InvalidArgument if a free index is out of range or listed twice. Table is left unchanged in that case.
+		 */
+		void restore(std::vector<EntityId::Generation> generations, std::vector<EntityId::Index> freeIndices) {
+			std::vector<bool> isFree(generations.size(), false);
+
+			for (const auto index : freeIndices)
+			{
+				if (index >= generations.size() || isFree[index])
+					throw Exceptions::InvalidArgument("ECS::EntityTable::restore() failed: Invalid free slot index.");
+
+				isFree[index] = true;
+			}
+
+			_generations = std::move(generations);
+			_freeIndices = std::move(freeIndices);
+
+			_alive.clear();
+			_alive.reserve(_generations.size() - _freeIndices.size());
+			_alivePositions.assign(_generations.size(), 0);
+
+			for (std::size_t index = 0; index < _generations.size(); ++index)
+			{
+				if (!isFree[index])
+					pushAlive(getHandle(static_cast<EntityId::Index>(index)));
+			}
+		}
+
+	private:
+		EntityId pushAlive(const EntityId id) {
+			_alivePositions[id.getIndex()] = _alive.size();
+			_alive.emplace_back(id);
+
+			return id;
+		}
+
+		std::vector<EntityId::Generation> _generations;
+		std::vector<EntityId::Index>	  _freeIndices;
+
+		std::vector<EntityId>			  _alive;
+		// Position of each slot's entity in _alive, meaningful only for live slots.
+		std::vector<std::size_t>		  _alivePositions;
+	};
+}
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <vector>
+
+#include "GameLibrary/ECS/EntityId.h"
+#include "GameLibrary/Event/BaseEvent.h"
+
+
+namespace GameLibrary::ECS
+{
+	// Batched component lifecycle events, dispatched by EntityManager::flushObservers() for observed component types.
+
+	template<typename C>
+	struct ComponentsAddedEvent : Event::BaseEvent {
+		const std::vector<EntityId>& entities;
+	};
+
+	template<typename C>
+	struct ComponentsReplacedEvent : Event::BaseEvent {
+		const std::vector<EntityId>& entities;
+	};
+
+	template<typename C>
+	struct ComponentsRemovedEvent : Event::BaseEvent {
+		const std::vector<EntityId>& entities;
+	};
+}
@@ -0,0 +1,16 @@
+#pragma once
+
+
+namespace GameLibrary::ECS
+{
+	/*
+	 *  Exclude: List of component types entities must NOT have to be part of a View or ComponentQuery.
+	 *
+	 *  		 Example: mgr.view<Position, Velocity>(exclude<Dead>)
+	 */
+	template<typename... Cs>
+	struct Exclude {};
+
+	template<typename... Cs>
+	inline constexpr Exclude<Cs...> exclude{};
+}
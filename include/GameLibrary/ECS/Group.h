@@ -0,0 +1,186 @@
+#pragma once
+
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#include <boost/mp11.hpp>
+
+#include "GameLibrary/ECS/EntityId.h"
+#include "GameLibrary/ECS/Storage/ComponentPool.h"
+#include "GameLibrary/ECS/Storage/TagPool.h"
+#include "GameLibrary/Utilities/ThreadPool.h"
+
+
+namespace GameLibrary::ECS
+{
+	/*
+	 *  BaseOwningGroup: Type-erased interface of OwningGroup<Owned...>, notified by storage of changes to owned component types.
+	 */
+	class BaseOwningGroup
+	{
+	public:
+		virtual ~BaseOwningGroup() = default;
+
+		// Called after entity got a component of one of owned types.
+		virtual void onComponentAdded(const EntityId id) = 0;
+		// Called before entity loses a component of one of owned types, or all of its components.
+		virtual void onComponentRemoving(const EntityId id) = 0;
+
+		// Called after all owned pools were cleared.
+		void clear() {
+			_size = 0;
+		}
+
+		std::size_t size() const {
+			return _size;
+		}
+
+	protected:
+		std::size_t _size = 0;
+	};
+
+	/*
+	 *  OwningGroup: Keeps pools of Owned... components arranged so entities having all of them occupy positions [0, size())
+	 *  			 of every pool, in the same order. Pools are rearranged by swaps as entities enter or leave the group.
+	 *
+	 *  			 A pool may be owned by a single group. Created and updated by SparseSetStorage, iterated through Group.
+	 */
+	template<typename... Owned>
+	class OwningGroup : public BaseOwningGroup
+	{
+		static_assert(sizeof...(Owned) > 0, "ECS::OwningGroup: At least one component type is required.");
+		static_assert(boost::mp11::mp_is_set<boost::mp11::mp_list<Owned...>>::value, "ECS::OwningGroup: Component types must be unique.");
+		static_assert(!(isTagComponent<Owned> || ...), "ECS::OwningGroup: Tag components have no dense arrays to arrange, and can't be owned.");
+
+		using Lead = boost::mp11::mp_first<boost::mp11::mp_list<Owned...>>;
+	public:
+		/*
+		 *  OwningGroup(): Take ownership of pools, moving entities which already have all Owned... components into the group.
+		 */
+		explicit OwningGroup(ComponentPool<Owned>&... pools) : _pools(&pools...) {
+			// Entities are only ever swapped to positions already visited, so every entity is checked once.
+			const auto& entities = lead().getEntities();
+			for (std::size_t i = 0; i < entities.size(); ++i)
+				onComponentAdded(entities[i]);
+		}
+
+		virtual void onComponentAdded(const EntityId id) override {
+			if (!(std::get<ComponentPool<Owned>*>(_pools)->contains(id) && ...))
+				return;
+
+			if (lead().find(id) < _size)
+				return;
+
+			(swapInto<Owned>(id, _size), ...);
+			++_size;
+		}
+
+		virtual void onComponentRemoving(const EntityId id) override {
+			const auto position = lead().find(id);
+			if (position == ComponentPool<Lead>::npos || position >= _size)
+				return;
+
+			--_size;
+			(swapInto<Owned>(id, _size), ...);
+		}
+
+		bool contains(const EntityId id) const {
+			return lead().find(id) < _size;
+		}
+
+		template<typename C>
+		ComponentPool<C>& getPool() const {
+			return *std::get<ComponentPool<C>*>(_pools);
+		}
+
+		/*
+		 *  getEntities(): Return entities of owned pools - first size() of them are the group's entities.
+		 */
+		const std::vector<EntityId>& getEntities() const {
+			return lead().getEntities();
+		}
+
+	private:
+		ComponentPool<Lead>& lead() const {
+			return *std::get<ComponentPool<Lead>*>(_pools);
+		}
+
+		template<typename C>
+		void swapInto(const EntityId id, const std::size_t position) {
+			auto& pool = getPool<C>();
+			pool.swapPositions(pool.find(id), position);
+		}
+
+		std::tuple<ComponentPool<Owned>*...> _pools;
+	};
+
+	/*
+	 *  Group: Iterable set of entities having all of Owned... components, whose pools are owned by an OwningGroup.
+	 *
+	 *  	   Unlike View, no lookups are involved - i-th entity of the group has its components at position i of every pool,
+	 *  	   so iteration walks Owned... arrays in parallel. Owned pools may still be viewed (in group's order).
+	 *  	   Adding / removing owned components reorders the pools, and invalidates references into them.
+	 *
+	 *  	   Example: mgr.group<Position, Velocity, Mass>().forEach([ ] ( Position& p, Velocity& v, const Mass& m ) { ... });
+	 */
+	template<typename... Owned>
+	class Group
+	{
+	public:
+		explicit Group(OwningGroup<Owned...>& group) : _group(&group) {}
+
+		std::size_t size() const {
+			return _group->size();
+		}
+
+		bool contains(const EntityId id) const {
+			return _group->contains(id);
+		}
+
+		/*
+		 *  forEach(): Call func for every entity in the Group.
+		 *  		   func may take (EntityId, Owned&...) or just (Owned&...).
+		 *  		   func must not add or remove components of owned types.
+		 */
+		template<typename F>
+		void forEach(F&& func) const {
+			forEachIn(0, size(), func);
+		}
+
+		/*
+		 *  parallelForEach(): Call func for every entity in the Group, splitting it into ranges executed on threadPool.
+		 *  				   Takes same callbacks as forEach(). Returns after all entities are visited.
+		 *
+		 *  				   func is called concurrently, so it may only modify components of the entity it was called for.
+		 *  				   func must not add or remove components / entities.
+		 *
+		 *  Throws:
+		 *    - First exception thrown by func.
+		 */
+		template<typename F>
+		void parallelForEach(Utilities::ThreadPool& threadPool, F&& func, const Utilities::ParallelForOptions options = {}) const {
+			threadPool.parallelFor(size(), [ this, &func ] ( const std::size_t begin, const std::size_t end ) {
+				forEachIn(begin, end, func);
+			}, options);
+		}
+
+	private:
+		template<typename F>
+		void forEachIn(const std::size_t begin, const std::size_t end, F& func) const {
+			const auto* entities = _group->getEntities().data();
+			const std::tuple<Owned*...> components(_group->template getPool<Owned>().getComponents().data()...);
+
+			for (auto i = begin; i < end; ++i)
+			{
+				if constexpr (std::is_invocable_v<F&, EntityId, Owned&...>)
+					func(entities[i], std::get<Owned*>(components)[i]...);
+				else
+					func(std::get<Owned*>(components)[i]...);
+			}
+		}
+
+		OwningGroup<Owned...>* _group;
+	};
+}
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <cstddef>
+#include <ostream>
+#include <string>
+#include <vector>
+
+
+namespace GameLibrary::ECS
+{
+	/*
+	 *  MemoryUsage: Memory held by one part of an entity manager - its entity table, or the pool of one component type.
+	 *
+	 *  			 Bytes used are taken by live data, bytes reserved by whole buffers (capacity included).
+	 *  			 Only containers' own buffers are counted - heap memory owned by components themselves (strings, vectors, ...) isn't.
+	 */
+	struct MemoryUsage {
+		/*
+		 *  getFragmentation(): Return fraction of reserved bytes not taken by live data - 0 when packed, approaching 1 when mostly empty.
+		 *  					Pools never shrink, so a high value on a small pool points to capacity left over from an earlier peak.
+		 */
+		double getFragmentation() const {
+			return (bytesReserved > 0) ? 1.0 - static_cast<double>(bytesUsed) / static_cast<double>(bytesReserved) : 0.0;
+		}
+
+		std::string name;
+		// Count of live entities / components.
+		std::size_t count = 0;
+		std::size_t bytesUsed = 0;
+		std::size_t bytesReserved = 0;
+	};
+
+	/*
+	 *  MemoryStats: Memory held by an entity manager, as returned by EntityManager::getMemoryStats().
+	 */
+	struct MemoryStats {
+		std::size_t getBytesUsed() const;
+		std::size_t getBytesReserved() const;
+
+		// Entity slots with their generations, free slot stack, and per-slot signatures.
+		MemoryUsage				 entities;
+		std::size_t				 entitySlots = 0;
+		// Freed slots waiting for reuse.
+		std::size_t				 freeEntitySlots = 0;
+		// Storage's own bookkeeping, not belonging to any pool (e.g. per-entity component counts).
+		MemoryUsage				 storage;
+		// One per component type, in order of componentIndex().
+		std::vector<MemoryUsage> components;
+	};
+
+	/*
+	 *  addVectorUsage(): Add bytes of vector's first usedCount elements (all of them by default), and of its capacity, to usage.
+	 */
+	template<typename T>
+	void addVectorUsage(MemoryUsage& usage, const std::vector<T>& vector, const std::size_t usedCount) {
+		usage.bytesUsed += usedCount * sizeof(T);
+		usage.bytesReserved += vector.capacity() * sizeof(T);
+	}
+
+	template<typename T>
+	void addVectorUsage(MemoryUsage& usage, const std::vector<T>& vector) {
+		addVectorUsage(usage, vector, vector.size());
+	}
+
+	/*
+	 *  printMemoryStats(): Write stats to out as a table - entity table, storage, then component types by bytes reserved, largest first.
+	 */
+	void printMemoryStats(std::ostream& out, const MemoryStats& stats);
+}
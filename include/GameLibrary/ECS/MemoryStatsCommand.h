@@ -0,0 +1,43 @@
+#pragma once
+
+#include <iostream>
+
+#include "GameLibrary/Console/Console.h"
+#include "GameLibrary/ECS/EntityManager.h"
+#include "GameLibrary/ECS/MemoryStats.h"
+
+
+namespace GameLibrary::ECS
+{
+	/*
+	 *  MemoryStatsCommand: ConsoleObject handling "ecs_memory" command, which prints memory stats of an EntityManager
+	 *  					(see EntityManager::getMemoryStats() and printMemoryStats()). mgr and out must outlive the object.
+	 *
+	 * * * * * * *
+	 *
+	 *  Example usage:
+	 *
+	 *    console.initCommandInfos<MemoryStatsCommand>();
+	 *    console.addObject<MemoryStatsCommand>(mgr);
+	 *
+	 *    console.parse("ecs_memory");
+	 *
+	 * * * * * * *
+	 */
+	class MemoryStatsCommand : public Console::ConsoleObject
+	{
+	public:
+		static constexpr const char* commandName = "ecs_memory";
+
+		MemoryStatsCommand(Console::Console& console, const Console::Id id, const EntityManager& mgr, std::ostream& out = std::cout);
+
+		static Console::CommandInfoCollection getCommandInfos();
+
+	protected:
+		virtual void onCreation() override;
+
+	private:
+		const EntityManager& _mgr;
+		std::ostream&		 _out;
+	};
+}
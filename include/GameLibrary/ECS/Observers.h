@@ -0,0 +1,152 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "GameLibrary/ECS/Component.h"
+#include "GameLibrary/ECS/EntityId.h"
+#include "GameLibrary/ECS/Events.h"
+#include "GameLibrary/Event/Dispatcher.h"
+
+
+namespace GameLibrary::ECS
+{
+	/*
+	 *  ComponentObservers: Collects additions, replacements and removals of observed component types during a frame,
+	 *  					and delivers them as one batched event per type and kind on flush().
+	 *
+	 *  					Types which aren't observed cost a single array lookup per notification.
+	 */
+	template<typename Storage>
+	class ComponentObservers
+	{
+		class BaseObserver
+		{
+		public:
+			virtual ~BaseObserver() = default;
+
+			virtual void onEntityRemoved(const Storage& storage, const EntityId id) = 0;
+			virtual void flush(Event::Dispatcher& dispatcher) = 0;
+		};
+
+		template<typename C>
+		class Observer : public BaseObserver
+		{
+		public:
+			virtual void onEntityRemoved(const Storage& storage, const EntityId id) override {
+				if (storage.template has<C>(id))
+					removed.emplace_back(id);
+			}
+
+			virtual void flush(Event::Dispatcher& dispatcher) override {
+				dispatchBatch<ComponentsAddedEvent<C>>(dispatcher, added);
+				dispatchBatch<ComponentsReplacedEvent<C>>(dispatcher, replaced);
+				dispatchBatch<ComponentsRemovedEvent<C>>(dispatcher, removed);
+			}
+
+			std::vector<EntityId> added;
+			std::vector<EntityId> replaced;
+			std::vector<EntityId> removed;
+
+		private:
+			/*
+			 *  dispatchBatch(): Dispatch E carrying entities of pending, and leave pending empty.
+			 *  				 Batch is moved out first, so callbacks may add, replace or remove C - their changes are collected
+			 *  				 into pending (reallocating it safely), instead of into the vector being dispatched.
+			 */
+			template<typename E>
+			void dispatchBatch(Event::Dispatcher& dispatcher, std::vector<EntityId>& pending) {
+				if (pending.empty())
+					return;
+
+				// Swapping through _scratch reuses its capacity, and keeps nested flushes from sharing a buffer.
+				std::vector<EntityId> batch;
+				batch.swap(_scratch);
+				batch.swap(pending);
+
+				dispatcher.dispatchEvent(E{ {}, batch });
+
+				batch.clear();
+				_scratch.swap(batch);
+			}
+
+			std::vector<EntityId> _scratch;
+		};
+
+	public:
+		/*
+		 *  observe(): Start collecting lifecycle changes of components of type C. Has no effect if C is already observed.
+		 */
+		template<typename C>
+		void observe() {
+			const auto index = componentIndex<C>();
+
+			if (index >= _observers.size())
+				_observers.resize(index + 1);
+
+			if (!_observers[index])
+			{
+				_observers[index] = std::make_unique<Observer<C>>();
+				_active.emplace_back(_observers[index].get());
+			}
+		}
+
+		template<typename C>
+		bool isObserved() const {
+			return find<C>() != nullptr;
+		}
+
+		template<typename C>
+		void onAdded(const EntityId id) {
+			if (auto* observer = find<C>())
+				observer->added.emplace_back(id);
+		}
+
+		template<typename C>
+		void onAdded(const std::vector<EntityId>& ids) {
+			if (auto* observer = find<C>())
+				observer->added.insert(std::end(observer->added), std::cbegin(ids), std::cend(ids));
+		}
+
+		template<typename C>
+		void onReplaced(const EntityId id) {
+			if (auto* observer = find<C>())
+				observer->replaced.emplace_back(id);
+		}
+
+		template<typename C>
+		void onRemoved(const EntityId id) {
+			if (auto* observer = find<C>())
+				observer->removed.emplace_back(id);
+		}
+
+		/*
+		 *  onEntityRemoved(): Record removal of all observed components entity has. Must be called before they are removed from storage.
+		 */
+		void onEntityRemoved(const Storage& storage, const EntityId id) {
+			for (auto* observer : _active)
+				observer->onEntityRemoved(storage, id);
+		}
+
+		/*
+		 *  flush(): Dispatch ComponentsAddedEvent<C>, ComponentsReplacedEvent<C> and ComponentsRemovedEvent<C> for every observed C
+		 *  		 with changes collected since the last flush (in that order), then clear collected changes.
+		 */
+		void flush(Event::Dispatcher& dispatcher) {
+			for (auto* observer : _active)
+				observer->flush(dispatcher);
+		}
+
+	private:
+		template<typename C>
+		Observer<C>* find() const {
+			const auto index = componentIndex<C>();
+
+			return (index < _observers.size()) ? static_cast<Observer<C>*>(_observers[index].get()) : nullptr;
+		}
+
+		std::vector<std::unique_ptr<BaseObserver>> _observers;
+		// Observers in order of observe() calls - the order events are flushed in.
+		std::vector<BaseObserver*>				  _active;
+	};
+}
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <cstddef>
+#include <istream>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <boost/mp11.hpp>
+
+#include "GameLibrary/ECS/EntityId.h"
+#include "GameLibrary/Exceptions/Standard.h"
+
+
+namespace GameLibrary::ECS
+{
+	/*
+	 *  Prefab: Stored, pre-populated set of components, instantiated into entities by memberwise copy.
+	 *
+	 *  		Unlike BaseEntity, which only lists component types, Prefab holds component values - so spawned entities
+	 *  		need no patching after creation. Prefab can be used wherever an entity type E is expected (e.g. addEntity<E>()).
+	 *
+	 *  		Example: const Prefab<Position, Velocity, Health> bullet({ 0, 0 }, { 0, 10 }, { 1 });
+	 *  				 bullet.instantiate(mgr, 500);
+	 */
+	template<typename... Components>
+	class Prefab
+	{
+	public:
+		using ComponentsTuple = std::tuple<Components...>;
+
+		static_assert(boost::mp11::mp_is_set<boost::mp11::mp_list<Components...>>::value, "ECS::Prefab: Component types must be unique.");
+
+		Prefab() = default;
+		explicit Prefab(Components... components) : _components(std::move(components)...) {}
+
+		template<typename C>
+		C& get() {
+			return std::get<C>(_components);
+		}
+
+		template<typename C>
+		const C& get() const {
+			return std::get<C>(_components);
+		}
+
+		const ComponentsTuple& getComponents() const {
+			return _components;
+		}
+
+		/*
+		 *  instantiate(): Create entity in mgr with a copy of prefab's components.
+		 */
+		template<typename Manager>
+		EntityId instantiate(Manager& mgr) const {
+			return mgr.template addEntity<Prefab>(_components);
+		}
+
+		/*
+		 *  instantiate(): Create count entities in mgr with copies of prefab's components, reserving storage for all of them at once.
+		 */
+		template<typename Manager>
+		std::vector<EntityId> instantiate(Manager& mgr, const std::size_t count) const {
+			return mgr.template addEntities<Prefab>(count, _components);
+		}
+
+		/*
+		 *  operator>>(): Read prefab's components from stream, in order of Components..., using each component's operator>>.
+		 *  			  Allows loading prefabs from data files.
+		 *
+		 *  Throws:
+		 *    - InvalidArgument if any component fails to be read. Prefab is left unchanged in that case.
+		 */
+		friend std::istream& operator>>(std::istream& stream, Prefab& prefab) {
+			ComponentsTuple components;
+
+			boost::mp11::tuple_for_each(components, [ &stream ] ( auto& component ) {
+				if (!(stream >> component))
+					throw Exceptions::InvalidArgument("ECS::Prefab::operator>>() failed: Couldn't read component from stream.");
+			});
+
+			prefab._components = std::move(components);
+
+			return stream;
+		}
+
+	private:
+		ComponentsTuple _components;
+	};
+}
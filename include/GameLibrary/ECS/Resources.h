@@ -0,0 +1,142 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "GameLibrary/ECS/Component.h"
+#include "GameLibrary/Exceptions/Standard.h"
+
+
+namespace GameLibrary::ECS
+{
+	/*
+	 *  Resource: Marker of access to resource T in Scheduler declarations, e.g. Reads<Velocity, Resource<TimeStep>>().
+	 *  		  Being a distinct type, it gets its own componentIndex(), which never clashes with components.
+	 */
+	template<typename T>
+	struct Resource {};
+
+	template<typename T>
+	constexpr bool isResource = false;
+	template<typename T>
+	constexpr bool isResource<Resource<T>> = true;
+
+	/*
+	 *  resourceIndex(): Return process-wide index of resource type T.
+	 *
+	 *  				 Indices are assigned sequentially on first use (separately from componentIndex()), so they can index a dense slot table.
+	 */
+	inline std::size_t nextResourceIndex() {
+		static std::atomic<std::size_t> counter{0};
+		return counter++;
+	}
+
+	template<typename T>
+	std::size_t resourceIndex() {
+		static const std::size_t index = nextResourceIndex();
+		return index;
+	}
+
+	/*
+	 *  Resources: Table of singleton values (camera, time step, input state, ...), at most one per type.
+	 *
+	 *  		   Values live in slots indexed by resourceIndex<T>(), so access is an array load and a pointer dereference -
+	 *  		   no entity, pool or map lookup. Values keep their address until replaced or removed.
+	 */
+	class Resources
+	{
+	public:
+		/*
+		 *  emplace(): Construct resource T from ctorArgs, replacing existing one.
+		 *
+		 *  Returns:
+		 *    - Reference to new resource.
+		 */
+		template<typename T, typename... Args>
+		T& emplace(Args&&... ctorArgs) {
+			const auto index = resourceIndex<T>();
+
+			if (index >= _slots.size())
+				_slots.resize(index + 1);
+
+			auto slot = std::make_unique<Slot<T>>(std::forward<Args>(ctorArgs)...);
+			auto& value = slot->value;
+			_slots[index] = std::move(slot);
+
+			return value;
+		}
+
+		/*
+		 *  get(): Return reference to resource T.
+		 *
+		 *  Throws:
+		 *    - NotFoundError if there is no resource T.
+		 */
+		template<typename T>
+		T& get() {
+			auto* value = find<T>();
+			if (!value)
+				throw Exceptions::NotFoundError("ECS::Resources::get() failed: Resource doesn't exist.");
+
+			return *value;
+		}
+
+		template<typename T>
+		const T& get() const {
+			return const_cast<Resources&>(*this).get<T>();
+		}
+
+		/*
+		 *  find(): Return pointer to resource T, or nullptr if there is none.
+		 */
+		template<typename T>
+		T* find() {
+			const auto index = resourceIndex<T>();
+
+			return (index < _slots.size() && _slots[index]) ? &static_cast<Slot<T>&>(*_slots[index]).value : nullptr;
+		}
+
+		template<typename T>
+		const T* find() const {
+			return const_cast<Resources&>(*this).find<T>();
+		}
+
+		template<typename T>
+		bool contains() const {
+			return find<T>() != nullptr;
+		}
+
+		/*
+		 *  remove(): Destroy resource T. Has no effect if there is none.
+		 */
+		template<typename T>
+		void remove() {
+			const auto index = resourceIndex<T>();
+
+			if (index < _slots.size())
+				_slots[index].reset();
+		}
+
+		void clear() {
+			_slots.clear();
+		}
+
+	private:
+		struct BaseSlot {
+			virtual ~BaseSlot() = default;
+		};
+
+		template<typename T>
+		struct Slot : BaseSlot {
+			template<typename... Args>
+			explicit Slot(Args&&... ctorArgs) : value(makeComponent<T>(std::forward<Args>(ctorArgs)...)) {}
+
+			T value;
+		};
+
+		std::vector<std::unique_ptr<BaseSlot>> _slots;
+	};
+}
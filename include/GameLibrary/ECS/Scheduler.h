@@ -0,0 +1,135 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "GameLibrary/ECS/Component.h"
+#include "GameLibrary/Utilities/ThreadPool.h"
+
+
+namespace GameLibrary::ECS
+{
+	// Lists of component types a system reads / writes, passed to Scheduler::addSystem().
+	template<typename... Cs>
+	struct Reads {};
+	template<typename... Cs>
+	struct Writes {};
+
+	/*
+	 *  Scheduler: Runs systems - functions declaring which component types they read and write.
+	 *
+	 *  		   Two systems conflict if either writes a component type the other one reads or writes.
+	 *  		   A system depends on every conflicting system added before it, so results match running systems
+	 *  		   in order of addition, while non-conflicting systems may run concurrently on a ThreadPool.
+	 *
+	 *  		   World resources are declared with Resource<T> marker (see Resources.h), along with components.
+	 *  		   Systems should read components through a const EntityManager& - mutable access stamps changes,
+	 *  		   which writes the pool's change log and would race with other readers.
+	 *
+	 *  		   Systems creating views should be added with addSystem(mgr, ...), so storage of their components exists before they run.
+	 *
+	 *  		   Example: scheduler.addSystem(mgr, "movement", Reads<Velocity, Resource<TimeStep>>(), Writes<Position>(), [ &mgr ] { ... });
+	 */
+	class Scheduler
+	{
+	public:
+		using SystemId = std::size_t;
+		using Function = std::function<void()>;
+		using Clock = std::chrono::steady_clock;
+
+		/*
+		 *  SystemTiming: Timing of system's last run. start and finish are relative to start of the frame.
+		 */
+		struct SystemTiming {
+			Clock::duration start{};
+			Clock::duration finish{};
+
+			Clock::duration getDuration() const {
+				return finish - start;
+			}
+		};
+
+		template<typename... Rs, typename... Ws>
+		SystemId addSystem(std::string name, Reads<Rs...>, Writes<Ws...>, Function function) {
+			return addSystem(std::move(name), { componentIndex<Rs>()... }, { componentIndex<Ws>()... }, std::move(function));
+		}
+
+		/*
+		 *  addSystem(): Add system, creating storage of its declared components in mgr first (see EntityManager::prepareComponents()).
+		 *  			 Systems viewing component types no entity had yet may then run concurrently on their first run().
+		 */
+		template<typename Manager, typename... Rs, typename... Ws>
+		SystemId addSystem(Manager& mgr, std::string name, Reads<Rs...> reads, Writes<Ws...> writes, Function function) {
+			mgr.template prepareComponents<Rs..., Ws...>();
+			return addSystem(std::move(name), reads, writes, std::move(function));
+		}
+
+		/*
+		 *  addSystem(): Add system accessing components of supplied indices (see componentIndex()).
+		 *
+		 *  Returns:
+		 *    - Id of the system - its position in order of addition.
+		 */
+		SystemId addSystem(std::string name, std::vector<std::size_t> reads, std::vector<std::size_t> writes, Function function);
+
+		/*
+		 *  run(): Run all systems on calling thread, in order of addition.
+		 *
+		 *  Throws:
+		 *    - Exception thrown by a system. Systems after it are not run.
+		 */
+		void run();
+
+		/*
+		 *  run(): Run all systems on threadPool, each one after all systems it depends on have finished.
+		 *  	   Calling thread helps with execution while waiting.
+		 *
+		 *  Throws:
+		 *    - First exception thrown by a system, after all running systems have finished.
+		 *  	Systems depending (even indirectly) on the failed one are not run.
+		 */
+		void run(Utilities::ThreadPool& threadPool);
+
+		std::size_t getSystemCount() const;
+		const std::string& getName(const SystemId id) const;
+
+		/*
+		 *  getDependencies(): Return systems which must finish before system id starts.
+		 */
+		const std::vector<SystemId>& getDependencies(const SystemId id) const;
+
+		const SystemTiming& getTiming(const SystemId id) const;
+
+		/*
+		 *  getCriticalPath(): Return chain of dependent systems with the longest total duration in the last run, in order of execution.
+		 *  				   Frame can't finish faster than this chain, however many threads are used.
+		 */
+		std::vector<SystemId> getCriticalPath() const;
+
+		Clock::duration getCriticalPathDuration() const;
+
+	private:
+		struct System {
+			std::string				 name;
+			std::vector<std::size_t> reads;
+			std::vector<std::size_t> writes;
+			Function				 function;
+
+			std::vector<SystemId>	 dependencies;
+			std::vector<SystemId>	 dependents;
+			SystemTiming			 timing;
+		};
+
+		// State of a single parallel run().
+		struct Frame;
+
+		static bool conflicts(const System& first, const System& second);
+
+		void runSystem(Utilities::ThreadPool& threadPool, Frame& frame, const SystemId id);
+
+		std::vector<System> _systems;
+	};
+}
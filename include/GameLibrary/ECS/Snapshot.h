@@ -0,0 +1,304 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <boost/mp11.hpp>
+
+#include "GameLibrary/ECS/Component.h"
+#include "GameLibrary/ECS/EntityId.h"
+#include "GameLibrary/ECS/EntityManager.h"
+#include "GameLibrary/ECS/Storage/TagPool.h"
+#include "GameLibrary/Exceptions/Standard.h"
+#include "GameLibrary/Utilities/MappedFile.h"
+
+
+namespace GameLibrary::ECS
+{
+	/*
+	 *  Snapshot: Saves and loads whole state of an EntityManager - entity slots with their generations, and components
+	 *  		  of types Components... - in a versioned binary format.
+	 *
+	 *  		  Components are written as raw bytes, one column (entities, then components) per type, every section aligned to 16 bytes.
+	 *  		  Loading maps the file into memory and copies each column into its pool at once - there is no per-component parsing.
+	 *  		  Handles stay valid across save / load, stale handles stay stale, and freed slots are reused in the same order.
+	 *
+	 *  		  Files are only portable between builds with the same component layouts and byte order.
+	 *  		  Columns are matched by position in Components... and checked by size / alignment, not by type name.
+	 *
+	 * * * * * * *
+	 *
+	 *  Example usage:
+	 *
+	 *    using WorldSnapshot = Snapshot<Position, Velocity, Enemy>;
+	 *
+	 *    WorldSnapshot::save(mgr, "world.snap");
+	 *
+	 *    EntityManager loaded;
+	 *    WorldSnapshot::load(loaded, "world.snap");
+	 *
+	 * * * * * * *
+	 */
+	template<typename... Components>
+	class Snapshot
+	{
+		static_assert(boost::mp11::mp_is_set<boost::mp11::mp_list<Components...>>::value, "ECS::Snapshot: Component types must be unique.");
+		static_assert((std::is_trivially_copyable_v<Components> && ...), "ECS::Snapshot: Components must be trivially copyable.");
+		static_assert(((alignof(Components) <= 16) && ...), "ECS::Snapshot: Components must not be aligned to more than 16 bytes.");
+	public:
+		static constexpr std::uint32_t version = 1;
+
+		/*
+		 *  save(): Write entities and Components... of mgr to file at path, replacing it.
+		 *  		Components of other types are not saved.
+		 *
+		 *  Throws:
+		 *    - IoError if file can't be written.
+		 */
+		static void save(const EntityManager& mgr, const std::string& path) {
+			std::ofstream file(path, std::ios::binary | std::ios::trunc);
+			if (!file)
+				throw Exceptions::IoError("ECS::Snapshot::save() failed: Couldn't open \"" + path + "\".");
+
+			const auto& generations = mgr._entities.getGenerations();
+			const auto& freeIndices = mgr._entities.getFreeIndices();
+
+			FileHeader header{};
+			std::memcpy(header.magic, magic, sizeof(magic));
+			header.version = version;
+			header.byteOrder = byteOrderMark;
+			header.slotCount = generations.size();
+			header.freeCount = freeIndices.size();
+			header.columnCount = sizeof...(Components);
+
+			Writer writer(file);
+			writer.write(&header, sizeof(header));
+			writer.write(generations.data(), generations.size() * sizeof(EntityId::Generation));
+			writer.write(freeIndices.data(), freeIndices.size() * sizeof(EntityId::Index));
+
+			(saveColumn<Components>(mgr, writer), ...);
+
+			if (!file.flush())
+				throw Exceptions::IoError("ECS::Snapshot::save() failed: Couldn't write \"" + path + "\".");
+		}
+
+		/*
+		 *  load(): Restore entities and Components... saved by save() into mgr, which must be empty (never have created an entity).
+		 *  		Loaded components are stamped as added at mgr's current tick. Observers are not notified.
+		 *
+		 *  Throws:
+		 *    - InvalidArgument if mgr isn't empty.
+		 *    - IoError if file can't be read.
+		 *    - FormatError if file isn't a snapshot of Components..., or is damaged. mgr may be left partially loaded in that case.
+		 */
+		static void load(EntityManager& mgr, const std::string& path) {
+			if (mgr._entities.getCapacity() > 0)
+				throw Exceptions::InvalidArgument("ECS::Snapshot::load() failed: Entity manager isn't empty.");
+
+			const Utilities::MappedFile file(path);
+			Reader reader(file);
+
+			const auto& header = *static_cast<const FileHeader*>(reader.read(1, sizeof(FileHeader)));
+
+			if (std::memcmp(header.magic, magic, sizeof(magic)) != 0)
+				throw Exceptions::FormatError("ECS::Snapshot::load() failed: File isn't a snapshot.");
+			if (header.version != version)
+				throw Exceptions::FormatError("ECS::Snapshot::load() failed: Unsupported snapshot version.");
+			if (header.byteOrder != byteOrderMark)
+				throw Exceptions::FormatError("ECS::Snapshot::load() failed: Snapshot was saved with different byte order.");
+			if (header.columnCount != sizeof...(Components))
+				throw Exceptions::FormatError("ECS::Snapshot::load() failed: Snapshot holds different component types.");
+			if (header.slotCount > std::numeric_limits<EntityId::Index>::max() || header.freeCount > header.slotCount)
+				throw Exceptions::FormatError("ECS::Snapshot::load() failed: Invalid entity table.");
+
+			auto generations = readArray<EntityId::Generation>(reader, static_cast<std::size_t>(header.slotCount));
+			auto freeIndices = readArray<EntityId::Index>(reader, static_cast<std::size_t>(header.freeCount));
+
+			try {
+				mgr._entities.restore(std::move(generations), std::move(freeIndices));
+			} catch (const Exceptions::InvalidArgument&) {
+				throw Exceptions::FormatError("ECS::Snapshot::load() failed: Invalid entity table.");
+			}
+			mgr._signatures.assign(mgr._entities.getCapacity(), ComponentMask());
+
+			(loadColumn<Components>(mgr, reader), ...);
+		}
+
+	private:
+		static constexpr char		   magic[8] = { 'G', 'L', 'S', 'N', 'A', 'P', '\0', '\0' };
+		// Read back as a different value on machines with other byte order.
+		static constexpr std::uint32_t byteOrderMark = 0x01020304;
+		static constexpr std::size_t   sectionAlignment = 16;
+
+		struct FileHeader {
+			char		  magic[8];
+			std::uint32_t version;
+			std::uint32_t byteOrder;
+			std::uint64_t slotCount;
+			std::uint64_t freeCount;
+			std::uint64_t columnCount;
+			std::uint64_t reserved;
+		};
+
+		struct ColumnHeader {
+			std::uint64_t count;
+			std::uint32_t elementSize;
+			std::uint32_t alignment;
+			std::uint32_t isTag;
+			std::uint32_t reserved[3];
+		};
+
+		static_assert(sizeof(FileHeader) % sectionAlignment == 0 && sizeof(ColumnHeader) % sectionAlignment == 0);
+
+		// Writes sections, padding each to sectionAlignment.
+		class Writer
+		{
+		public:
+			explicit Writer(std::ofstream& file) : _file(file) {}
+
+			void write(const void* data, const std::size_t size) {
+				static constexpr char padding[sectionAlignment] = {};
+
+				_file.write(static_cast<const char*>(data), static_cast<std::streamsize>(size));
+				if (size % sectionAlignment != 0)
+					_file.write(padding, static_cast<std::streamsize>(sectionAlignment - size % sectionAlignment));
+			}
+
+		private:
+			std::ofstream& _file;
+		};
+
+		// Reads sections written by Writer, straight from mapped file.
+		class Reader
+		{
+		public:
+			explicit Reader(const Utilities::MappedFile& file) : _data(file.data()), _size(file.size()) {}
+
+			/*
+			 *  read(): Return pointer to next section of count elements of elementSize bytes, and skip past it.
+			 *
+			 *  Throws:
+			 *    - FormatError if file ends before the section does.
+			 */
+			const void* read(const std::size_t count, const std::size_t elementSize) {
+				const auto remaining = _size - _offset;
+				if (count > remaining / elementSize)
+					throw Exceptions::FormatError("ECS::Snapshot::load() failed: File is truncated.");
+
+				// Padding is part of the section - a file missing it was cut short.
+				const auto paddedSize = (count * elementSize + sectionAlignment - 1) / sectionAlignment * sectionAlignment;
+				if (paddedSize > remaining)
+					throw Exceptions::FormatError("ECS::Snapshot::load() failed: File is truncated.");
+
+				const auto* section = _data + _offset;
+				_offset += paddedSize;
+
+				return section;
+			}
+
+		private:
+			const std::byte* _data;
+			std::size_t		 _size;
+			std::size_t		 _offset = 0;
+		};
+
+		template<typename T>
+		static std::vector<T> readArray(Reader& reader, const std::size_t count) {
+			// Section is read first, so a forged count fails as truncated file rather than allocating.
+			const auto* source = reader.read(count, sizeof(T));
+
+			std::vector<T> array(count);
+			if (count > 0)
+				std::memcpy(array.data(), source, count * sizeof(T));
+
+			return array;
+		}
+
+		template<typename C>
+		static ColumnHeader makeColumnHeader(const std::uint64_t count) {
+			ColumnHeader header{};
+			header.count = count;
+			header.elementSize = isTagComponent<C> ? 0 : static_cast<std::uint32_t>(sizeof(C));
+			header.alignment = static_cast<std::uint32_t>(alignof(C));
+			header.isTag = isTagComponent<C> ? 1 : 0;
+
+			return header;
+		}
+
+		template<typename C>
+		static void saveColumn(const EntityManager& mgr, Writer& writer) {
+			const auto* pool = mgr._storage.template findPool<C>();
+
+			if constexpr (isTagComponent<C>)
+			{
+				// Tags are kept per slot - collect handles of tagged slots.
+				std::vector<EntityId> entities;
+				if (pool)
+				{
+					entities.reserve(pool->size());
+
+					const auto& words = pool->getWords();
+					for (std::size_t word = 0; word < words.size(); ++word)
+					{
+						forEachSetIndex(words[word], word * TagPool<C>::wordBits, [ &mgr, &entities ] ( const std::size_t index ) {
+							entities.emplace_back(mgr._entities.getHandle(static_cast<EntityId::Index>(index)));
+						});
+					}
+				}
+
+				const auto header = makeColumnHeader<C>(entities.size());
+				writer.write(&header, sizeof(header));
+				writer.write(entities.data(), entities.size() * sizeof(EntityId));
+			}
+			else
+			{
+				const auto count = pool ? pool->size() : 0;
+				const auto header = makeColumnHeader<C>(count);
+
+				writer.write(&header, sizeof(header));
+				if (pool)
+				{
+					writer.write(pool->getEntities().data(), count * sizeof(EntityId));
+					writer.write(pool->getComponents().data(), count * sizeof(C));
+				}
+			}
+		}
+
+		template<typename C>
+		static void loadColumn(EntityManager& mgr, Reader& reader) {
+			const auto& header = *static_cast<const ColumnHeader*>(reader.read(1, sizeof(ColumnHeader)));
+			const auto expected = makeColumnHeader<C>(header.count);
+
+			if (header.isTag != expected.isTag || header.elementSize != expected.elementSize || header.alignment != expected.alignment)
+				throw Exceptions::FormatError("ECS::Snapshot::load() failed: Snapshot holds different component types.");
+
+			const auto count = static_cast<std::size_t>(header.count);
+			// Sections are aligned to 16 bytes, and so is the mapping - arrays can be used in place.
+			const auto* entities = static_cast<const EntityId*>(reader.read(count, sizeof(EntityId)));
+			const C* components = nullptr;
+			if constexpr (!isTagComponent<C>)
+				components = static_cast<const C*>(reader.read(count, sizeof(C)));
+
+			const auto index = componentIndex<C>();
+			for (std::size_t i = 0; i < count; ++i)
+			{
+				if (!mgr._entities.isAlive(entities[i]))
+					throw Exceptions::FormatError("ECS::Snapshot::load() failed: Component belongs to a nonexistent entity.");
+
+				auto& signature = mgr._signatures[entities[i].getIndex()];
+				if (signature.test(index))
+					throw Exceptions::FormatError("ECS::Snapshot::load() failed: Entity has duplicate component.");
+
+				signature.set(index);
+			}
+
+			mgr._storage.template assign<C>(entities, components, count);
+		}
+	};
+}
@@ -0,0 +1,456 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "GameLibrary/ECS/EntityId.h"
+#include "GameLibrary/ECS/Storage/ComponentPool.h"
+#include "GameLibrary/Exceptions/Standard.h"
+
+
+namespace GameLibrary::ECS
+{
+	/*
+	 *  MemberPosition: Default position accessor of SpatialGrid - reads x and y members of position component.
+	 */
+	struct MemberPosition {
+		template<typename P>
+		auto operator() (const P& position) const {
+			return std::pair<float, float>(static_cast<float>(position.x), static_cast<float>(position.y));
+		}
+	};
+
+	/*
+	 *  SpatialGrid: Spatial hash of entity positions taken from component P, answering radius, box and k-nearest queries
+	 *  			 by visiting only cells overlapping the query, instead of every entity.
+	 *
+	 *  			 Space is split into square cells of cellSize, only occupied cells are stored (hashed by cell coordinates),
+	 *  			 so the world needs no bounds. Cell size around typical query radius works best.
+	 *  			 GetPosition maps P to (x, y) pair, see MemberPosition.
+	 *
+	 *  			 Grid is updated incrementally from component change ticks - only entities whose P changed since
+	 *  			 the last update are moved. Removed components are not tracked by ticks, pass them to remove(),
+	 *  			 e.g. from ComponentsRemovedEvent<P> dispatched by observed EntityManager.
+	 *
+	 * * * * * * *
+	 *
+	 *  Example usage:
+	 *
+	 *    SpatialGrid<Position> grid(32.0f);
+	 *
+	 *    const auto since = _lastUpdate;
+	 *    _lastUpdate = mgr.advanceChangeTick();
+	 *    grid.update(mgr, since);
+	 *
+	 *    grid.forEachInRadius({ x, y }, 100.0f, [ ] ( const EntityId id ) { ... });
+	 *    const auto closest = grid.findNearest({ x, y }, 5);
+	 *
+	 * * * * * * *
+	 */
+	template<typename P, typename GetPosition = MemberPosition>
+	class SpatialGrid
+	{
+		using CellKey = std::uint64_t;
+		using Cell = std::vector<std::uint32_t>;
+
+		struct CellKeyHash {
+			std::size_t operator() (const CellKey key) const noexcept {
+				return static_cast<std::size_t>((key * 0x9E3779B97F4A7C15ull) >> 16);
+			}
+		};
+
+	public:
+		struct Point {
+			float x = 0.0f;
+			float y = 0.0f;
+		};
+
+		/*
+		 *  SpatialGrid(): Construct empty grid of cells with side cellSize.
+		 *
+		 *  Throws:
+		 *    - InvalidArgument if cellSize isn't positive.
+		 */
+		explicit SpatialGrid(const float cellSize, GetPosition getPosition = {})
+				: _cellSize(cellSize), _inverseCellSize(1.0f / cellSize), _getPosition(std::move(getPosition)) {
+			if (!(cellSize > 0.0f))
+				throw Exceptions::InvalidArgument("ECS::SpatialGrid::SpatialGrid() failed: Cell size must be positive.");
+		}
+
+		/*
+		 *  update(): Insert or move every entity whose P component was added or changed after tick since.
+		 *  		  Manager must support change ticks (EntityManager, StaticWorld).
+		 *
+		 *  Throws:
+		 *    - InvalidArgument if a position isn't finite. Entities visited before it are already updated.
+		 */
+		template<typename Manager>
+		void update(Manager& mgr, const ChangeTick since) {
+			mgr.template view<P>().template changed<P>(since).forEach([ this ] ( const EntityId id, const P& position ) {
+				const auto [x, y] = _getPosition(position);
+				set(id, { x, y });
+			});
+		}
+
+		/*
+		 *  rebuild(): Clear grid, and insert every entity having P component.
+		 *
+		 *  Throws:
+		 *    - InvalidArgument if a position isn't finite. Entities visited before it are already inserted.
+		 */
+		template<typename Manager>
+		void rebuild(Manager& mgr) {
+			clear();
+			mgr.template view<P>().forEach([ this ] ( const EntityId id, const P& position ) {
+				const auto [x, y] = _getPosition(position);
+				set(id, { x, y });
+			});
+		}
+
+		/*
+		 *  set(): Insert entity at point, or move it there if it's already in grid.
+		 *  	   Entity replaces stale handle with the same index (entity removed without calling remove()).
+		 *
+		 *  Throws:
+		 *    - InvalidArgument if point isn't finite.
+		 */
+		void set(const EntityId id, const Point point) {
+			if (!std::isfinite(point.x) || !std::isfinite(point.y))
+				throw Exceptions::InvalidArgument("ECS::SpatialGrid::set() failed: Point must be finite.");
+
+			const auto index = getEntityIndex(id);
+			const auto cell = cellKeyOf(point);
+
+			if (index < _sparse.size() && _sparse[index] != npos)
+			{
+				auto& entry = _entries[_sparse[index]];
+				entry.id = id;
+				entry.point = point;
+
+				if (entry.cell != cell)
+				{
+					unlinkFromCell(_sparse[index]);
+					linkToCell(_sparse[index], cell);
+				}
+
+				return;
+			}
+
+			if (index >= _sparse.size())
+				_sparse.resize(index + 1, npos);
+
+			_sparse[index] = _entries.size();
+			_entries.push_back({ id, point, cell, 0 });
+			linkToCell(_entries.size() - 1, cell);
+		}
+
+		/*
+		 *  remove(): Remove entity from grid. Has no effect if entity (with this generation) isn't in grid.
+		 */
+		void remove(const EntityId id) {
+			if (!contains(id))
+				return;
+
+			const auto index = getEntityIndex(id);
+			const auto position = _sparse[index];
+			const auto last = _entries.size() - 1;
+
+			unlinkFromCell(position);
+
+			if (position != last)
+			{
+				_entries[position] = _entries[last];
+				_sparse[getEntityIndex(_entries[position].id)] = position;
+				_cells.find(_entries[position].cell)->second[_entries[position].positionInCell] = static_cast<std::uint32_t>(position);
+			}
+
+			_entries.pop_back();
+			_sparse[index] = npos;
+		}
+
+		void remove(const std::vector<EntityId>& ids) {
+			for (const auto id : ids)
+				remove(id);
+		}
+
+		bool contains(const EntityId id) const {
+			const auto index = getEntityIndex(id);
+
+			return index < _sparse.size() && _sparse[index] != npos && _entries[_sparse[index]].id == id;
+		}
+
+		/*
+		 *  getPoint(): Return point entity was last set at.
+		 *
+		 *  Throws:
+		 *    - NotFoundError if entity isn't in grid.
+		 */
+		Point getPoint(const EntityId id) const {
+			if (!contains(id))
+				throw Exceptions::NotFoundError("ECS::SpatialGrid::getPoint() failed: Entity isn't in grid.");
+
+			return _entries[_sparse[getEntityIndex(id)]].point;
+		}
+
+		std::size_t size() const {
+			return _entries.size();
+		}
+
+		std::size_t getCellCount() const {
+			return _cells.size();
+		}
+
+		float getCellSize() const {
+			return _cellSize;
+		}
+
+		void clear() {
+			_entries.clear();
+			_sparse.clear();
+			_cells.clear();
+		}
+
+		/*
+		 *  forEachInBox(): Call func(id) for every entity inside axis-aligned box [min, max] (bounds inclusive).
+		 *  				func must not modify the grid.
+		 */
+		template<typename F>
+		void forEachInBox(const Point min, const Point max, F&& func) const {
+			forEachEntryInCells(cellCoordinate(min.x), cellCoordinate(min.y), cellCoordinate(max.x), cellCoordinate(max.y), [ &min, &max, &func ] ( const Entry& entry ) {
+				if (entry.point.x >= min.x && entry.point.x <= max.x && entry.point.y >= min.y && entry.point.y <= max.y)
+					func(entry.id);
+			});
+		}
+
+		/*
+		 *  forEachInRadius(): Call func(id) for every entity within radius of center (inclusive).
+		 *  				   func must not modify the grid.
+		 */
+		template<typename F>
+		void forEachInRadius(const Point center, const float radius, F&& func) const {
+			const auto radiusSquared = radius * radius;
+
+			forEachEntryInCells(cellCoordinate(center.x - radius), cellCoordinate(center.y - radius),
+								cellCoordinate(center.x + radius), cellCoordinate(center.y + radius), [ &center, radiusSquared, &func ] ( const Entry& entry ) {
+				if (distanceSquared(entry.point, center) <= radiusSquared)
+					func(entry.id);
+			});
+		}
+
+		/*
+		 *  findNearest(): Return up to count entities closest to center, nearest first, skipping entities for which accept(id) returns false.
+		 *  			   Searches rings of cells around center, stopping once no unvisited cell can hold a closer entity.
+		 */
+		template<typename F>
+		std::vector<EntityId> findNearest(const Point center, const std::size_t count, F&& accept) const {
+			std::vector<std::pair<float, EntityId>> nearest;
+			if (count == 0 || _entries.empty())
+				return {};
+
+			nearest.reserve(count);
+			const auto consider = [ &nearest, &center, count, &accept ] ( const Entry& entry ) {
+				const auto distance = distanceSquared(entry.point, center);
+
+				if (nearest.size() == count && distance >= nearest.front().first)
+					return;
+				if (!accept(entry.id))
+					return;
+
+				if (nearest.size() == count)
+				{
+					std::pop_heap(std::begin(nearest), std::end(nearest));
+					nearest.pop_back();
+				}
+				nearest.emplace_back(distance, entry.id);
+				std::push_heap(std::begin(nearest), std::end(nearest));
+			};
+
+			const auto centerX = cellCoordinate(center.x);
+			const auto centerY = cellCoordinate(center.y);
+
+			for (std::int64_t ring = 0; ; ++ring)
+			{
+				// Ring has more cells than the whole grid - scanning occupied cells outside visited square is cheaper.
+				if (ring > 0 && static_cast<std::size_t>(8 * ring) > _cells.size())
+				{
+					for (const auto& [key, cell] : _cells)
+					{
+						const auto distance = std::max(std::abs(cellX(key) - centerX), std::abs(cellY(key) - centerY));
+						if (distance >= ring)
+						{
+							for (const auto position : cell)
+								consider(_entries[position]);
+						}
+					}
+
+					break;
+				}
+
+				forEachCellInRing(centerX, centerY, ring, [ this, &consider ] ( const CellKey key ) {
+					if (const auto it = _cells.find(key); it != std::cend(_cells))
+					{
+						for (const auto position : it->second)
+							consider(_entries[position]);
+					}
+				});
+
+				// Cells of next ring are at least ring whole cells away from center.
+				const auto reach = static_cast<float>(ring) * _cellSize;
+				if (nearest.size() == count && reach * reach >= nearest.front().first)
+					break;
+			}
+
+			std::sort_heap(std::begin(nearest), std::end(nearest));
+
+			std::vector<EntityId> result;
+			result.reserve(nearest.size());
+			for (const auto& candidate : nearest)
+				result.emplace_back(candidate.second);
+
+			return result;
+		}
+
+		std::vector<EntityId> findNearest(const Point center, const std::size_t count) const {
+			return findNearest(center, count, [ ] ( const EntityId ) { return true; });
+		}
+
+	private:
+		struct Entry {
+			EntityId	  id;
+			Point		  point;
+			CellKey		  cell;
+			std::uint32_t positionInCell;
+		};
+
+		static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+		// Keeps cell coordinates (and their differences) far from integer overflow, however far entities wander.
+		static constexpr float maxCellCoordinate = 1 << 30;
+
+		static float distanceSquared(const Point& a, const Point& b) {
+			const auto dx = a.x - b.x;
+			const auto dy = a.y - b.y;
+
+			return dx * dx + dy * dy;
+		}
+
+		std::int64_t cellCoordinate(const float value) const {
+			const auto scaled = std::floor(value * _inverseCellSize);
+
+			// Only query arguments can be NaN here (set() rejects them), clamp would pass it through to an undefined cast.
+			if (std::isnan(scaled))
+				return 0;
+
+			return static_cast<std::int64_t>(std::clamp(scaled, -maxCellCoordinate, maxCellCoordinate));
+		}
+
+		static CellKey makeCellKey(const std::int64_t x, const std::int64_t y) {
+			return (static_cast<CellKey>(static_cast<std::uint32_t>(x)) << 32) | static_cast<std::uint32_t>(y);
+		}
+
+		static std::int64_t cellX(const CellKey key) {
+			return static_cast<std::int32_t>(static_cast<std::uint32_t>(key >> 32));
+		}
+
+		static std::int64_t cellY(const CellKey key) {
+			return static_cast<std::int32_t>(static_cast<std::uint32_t>(key));
+		}
+
+		CellKey cellKeyOf(const Point& point) const {
+			return makeCellKey(cellCoordinate(point.x), cellCoordinate(point.y));
+		}
+
+		void linkToCell(const std::size_t position, const CellKey key) {
+			auto& cell = _cells[key];
+
+			_entries[position].cell = key;
+			_entries[position].positionInCell = static_cast<std::uint32_t>(cell.size());
+			cell.emplace_back(static_cast<std::uint32_t>(position));
+		}
+
+		void unlinkFromCell(const std::size_t position) {
+			const auto it = _cells.find(_entries[position].cell);
+			auto& cell = it->second;
+			const auto positionInCell = _entries[position].positionInCell;
+
+			cell[positionInCell] = cell.back();
+			_entries[cell[positionInCell]].positionInCell = positionInCell;
+			cell.pop_back();
+
+			if (cell.empty())
+				_cells.erase(it);
+		}
+
+		template<typename F>
+		void forEachEntryInCells(const std::int64_t minX, const std::int64_t minY, const std::int64_t maxX, const std::int64_t maxY, F&& func) const {
+			if (minX > maxX || minY > maxY)
+				return;
+
+			const auto width = static_cast<std::uint64_t>(maxX - minX + 1);
+			const auto height = static_cast<std::uint64_t>(maxY - minY + 1);
+
+			// Query covers more cells than are occupied - walk occupied cells instead of probing empty ones.
+			if (width * height > _cells.size())
+			{
+				for (const auto& [key, cell] : _cells)
+				{
+					const auto x = cellX(key);
+					const auto y = cellY(key);
+
+					if (x >= minX && x <= maxX && y >= minY && y <= maxY)
+					{
+						for (const auto position : cell)
+							func(_entries[position]);
+					}
+				}
+
+				return;
+			}
+
+			for (auto x = minX; x <= maxX; ++x)
+			{
+				for (auto y = minY; y <= maxY; ++y)
+				{
+					if (const auto it = _cells.find(makeCellKey(x, y)); it != std::cend(_cells))
+					{
+						for (const auto position : it->second)
+							func(_entries[position]);
+					}
+				}
+			}
+		}
+
+		template<typename F>
+		static void forEachCellInRing(const std::int64_t centerX, const std::int64_t centerY, const std::int64_t ring, F&& func) {
+			if (ring == 0)
+			{
+				func(makeCellKey(centerX, centerY));
+				return;
+			}
+
+			for (auto x = centerX - ring; x <= centerX + ring; ++x)
+			{
+				func(makeCellKey(x, centerY - ring));
+				func(makeCellKey(x, centerY + ring));
+			}
+			for (auto y = centerY - ring + 1; y <= centerY + ring - 1; ++y)
+			{
+				func(makeCellKey(centerX - ring, y));
+				func(makeCellKey(centerX + ring, y));
+			}
+		}
+
+		float		_cellSize;
+		float		_inverseCellSize;
+		GetPosition _getPosition;
+
+		std::vector<Entry>								  _entries;
+		// Entity index -> position in _entries, or npos.
+		std::vector<std::size_t>						  _sparse;
+		std::unordered_map<CellKey, Cell, CellKeyHash>	  _cells;
+	};
+}
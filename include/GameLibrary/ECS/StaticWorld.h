@@ -0,0 +1,230 @@
+#pragma once
+
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#include <boost/mp11.hpp>
+
+#include "GameLibrary/ECS/Entity.h"
+#include "GameLibrary/ECS/EntityId.h"
+#include "GameLibrary/ECS/EntityTable.h"
+#include "GameLibrary/ECS/Storage/ComponentPool.h"
+#include "GameLibrary/ECS/Storage/TagPool.h"
+#include "GameLibrary/ECS/View.h"
+#include "GameLibrary/Exceptions/Standard.h"
+
+
+namespace GameLibrary::ECS
+{
+	/*
+	 *  StaticWorld: Entity manager with its full list of component types known at compile time.
+	 *
+	 *  			 Holds a tuple of ComponentPools, indexed by position of component type in Components...,
+	 *  			 so every pool access compiles down to direct member access - no typeid, no runtime pool table.
+	 *  			 Offers the same API as EntityManager, so projects can switch between the two.
+	 *
+	 *  			 Example: using World = StaticWorld<Position, Velocity, Health>;
+	 */
+	template<typename... Components>
+	class StaticWorld
+	{
+		using ComponentList = boost::mp11::mp_list<Components...>;
+
+		static_assert(boost::mp11::mp_is_set<ComponentList>::value, "ECS::StaticWorld: Component types must be unique.");
+
+		template<typename C>
+		static constexpr std::size_t indexOf() {
+			static_assert(boost::mp11::mp_contains<ComponentList, C>::value, "ECS::StaticWorld: Component type is not part of this world.");
+
+			return boost::mp11::mp_find<ComponentList, C>::value;
+		}
+
+	public:
+		using Id = EntityId;
+
+		/*
+		 *  createEntity(): Return handle to a new entity without components.
+		 */
+		Id createEntity() {
+			return _entities.create();
+		}
+
+		template<typename E>
+		Id addEntity(typename E::ComponentsTuple components = {}) {
+			const auto id = _entities.create();
+
+			boost::mp11::tuple_for_each(std::move(components), [ this, id ] ( auto&& component ) {
+				getPool<std::decay_t<decltype(component)>>().emplace(id, std::move(component));
+			});
+
+			return id;
+		}
+
+		/*
+		 *  addEntities(): Create count entities of type E, reserving ids and pools for all of them up front.
+		 *  			   init is a prototype E::ComponentsTuple, or a generator returning one for each i in [0, count).
+		 */
+		template<typename E, typename Init = typename E::ComponentsTuple>
+		std::vector<Id> addEntities(const std::size_t count, Init&& init = {}) {
+			using ComponentsTuple = typename E::ComponentsTuple;
+
+			boost::mp11::mp_for_each<boost::mp11::mp_transform<boost::mp11::mp_identity, ComponentsTuple>>([ this, count ] ( auto type ) {
+				reserveComponents<typename decltype(type)::type>(count);
+			});
+
+			auto ids = _entities.create(count);
+
+			for (std::size_t i = 0; i < count; ++i)
+			{
+				boost::mp11::tuple_for_each(makeEntityComponents<ComponentsTuple>(init, i), [ this, id = ids[i] ] ( auto&& component ) {
+					getPool<std::decay_t<decltype(component)>>().emplace(id, std::move(component));
+				});
+			}
+
+			return ids;
+		}
+
+		/*
+		 *  addComponent(): Construct entity's component of type C from ctorArgs.
+		 *  				Has no effect if entity already has one.
+		 *
+		 *  Returns:
+		 *    - Reference to entity's component.
+		 *
+		 *  Throws:
+		 *    - NotFoundError if entity doesn't exist.
+		 */
+		template<typename C, typename... Args>
+		C& addComponent(const Id id, Args&&... ctorArgs) {
+			if (!_entities.isAlive(id))
+				throw Exceptions::NotFoundError("ECS::StaticWorld::addComponent() failed: Entity doesn't exist.");
+
+			return getPool<C>().emplace(id, std::forward<Args>(ctorArgs)...);
+		}
+
+		template<typename C>
+		void reserveComponents(const std::size_t additional) {
+			auto& pool = getPool<C>();
+			pool.reserve(pool.size() + additional);
+		}
+
+		/*
+		 *  removeComponent(): Destroy entity's component of type C. Has no effect on stale handles.
+		 */
+		template<typename C>
+		void removeComponent(const Id id) {
+			// Tags are kept per slot - a stale handle would hit the entity now occupying it.
+			if (_entities.isAlive(id))
+				getPool<C>().remove(id);
+		}
+
+		template<typename C>
+		bool entityHasComponent(const Id id) const {
+			return _entities.isAlive(id) && getPool<C>().contains(id);
+		}
+
+		bool entityExists(const Id id) const {
+			return _entities.isAlive(id);
+		}
+
+		std::size_t getCount() const {
+			return _entities.getAliveCount();
+		}
+
+		const std::vector<Id>& getEntities() const {
+			return _entities.getAlive();
+		}
+
+		template<typename F>
+		void forEachEntity(F&& func) const {
+			for (const auto id : _entities.getAlive())
+				func(id);
+		}
+
+		/*
+		 *  getComponent(): Return reference to entity's component of type C, marking it changed.
+		 *
+		 *  Throws:
+		 *    - NotFoundError if entity doesn't have component C.
+		 */
+		template<typename C>
+		C& getComponent(const Id id) {
+			auto& pool = getPool<C>();
+			auto& component = pool.get(id);
+
+			pool.markChanged(id);
+
+			return component;
+		}
+
+		/*
+		 *  getComponent(): Return const reference to entity's component of type C, without marking it changed.
+		 *
+		 *  Throws:
+		 *    - NotFoundError if entity doesn't have component C.
+		 */
+		template<typename C>
+		const C& getComponent(const Id id) const {
+			return getPool<C>().get(id);
+		}
+
+		template<typename C>
+		void markComponentChanged(const Id id) {
+			getPool<C>().markChanged(id);
+		}
+
+		ChangeTick getChangeTick() const {
+			return *_tick;
+		}
+
+		ChangeTick advanceChangeTick() {
+			return (*_tick)++;
+		}
+
+		template<typename C>
+		PoolFor<C>& getComponents() {
+			return getPool<C>();
+		}
+
+		/*
+		 *  view(): Return View of entities having all of Cs... components, and none of Es... components.
+		 */
+		template<typename... Cs, typename... Es>
+		View<Exclude<Es...>, Cs...> view(Exclude<Es...> = {}) {
+			return View<Exclude<Es...>, Cs...>(getPool<Cs>()..., &getPool<Es>()...);
+		}
+
+		template<typename... Cs, typename F>
+		void forEach(F&& func) {
+			view<Cs...>().forEach(std::forward<F>(func));
+		}
+
+		/*
+		 *  removeEntity(): Destroy entity's components and invalidate its handle. Has no effect on stale handles.
+		 */
+		void removeEntity(const Id id) {
+			if (!_entities.isAlive(id))
+				return;
+
+			boost::mp11::tuple_for_each(_pools, [ id ] ( auto& pool ) { pool.remove(id); });
+			_entities.destroy(id);
+		}
+
+		template<typename C>
+		PoolFor<C>& getPool() {
+			return std::get<indexOf<C>()>(_pools);
+		}
+
+		template<typename C>
+		const PoolFor<C>& getPool() const {
+			return std::get<indexOf<C>()>(_pools);
+		}
+
+	private:
+		std::unique_ptr<ChangeTick>				 _tick = std::make_unique<ChangeTick>(1);
+		std::tuple<PoolFor<Components>...>		 _pools{ PoolFor<Components>(_tick.get())... };
+		EntityTable								 _entities;
+	};
+}
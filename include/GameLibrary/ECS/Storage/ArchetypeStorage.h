@@ -0,0 +1,533 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <new>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <typeindex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <boost/mp11.hpp>
+
+#include "GameLibrary/ECS/Component.h"
+#include "GameLibrary/ECS/ComponentMask.h"
+#include "GameLibrary/ECS/EntityId.h"
+#include "GameLibrary/Exceptions/Standard.h"
+
+
+namespace GameLibrary::ECS
+{
+	/*
+	 *  ArchetypeStorage: Component storage grouping entities by their exact set of component types (archetype).
+	 *
+	 *  				  Each archetype stores its entities in fixed-size chunks, with one contiguous column per component type.
+	 *  				  Iterating entities with forEach() therefore streams linearly through memory.
+	 *  				  Adding a component to an existing entity moves all of its components to another archetype - prefer insert().
+	 */
+	class ArchetypeStorage
+	{
+	public:
+		// Byte size of a single chunk. Chunks are only larger if a single row wouldn't fit.
+		static constexpr std::size_t chunkSize = 16 * 1024;
+
+	private:
+		/*
+		 *  ComponentType: Type-erased operations, required to move component values between rows and archetypes.
+		 */
+		struct ComponentType {
+			std::type_index type;
+			std::size_t index;
+			std::size_t size;
+			std::size_t alignment;
+			void (*moveConstruct)(void* destination, void* source);
+			void (*destroy)(void* component);
+		};
+
+		template<typename C>
+		static const ComponentType* componentType() {
+			static_assert(alignof(C) <= alignof(std::max_align_t), "ECS::ArchetypeStorage: Over-aligned components are not supported.");
+
+			static const ComponentType type{
+				typeid(C), componentIndex<C>(), sizeof(C), alignof(C),
+				[ ] ( void* destination, void* source ) { new (destination) C(std::move(*static_cast<C*>(source))); },
+				[ ] ( void* component ) { static_cast<C*>(component)->~C(); }
+			};
+
+			return &type;
+		}
+
+		using TypeList = std::vector<const ComponentType*>;
+		using Signature = std::vector<std::type_index>;
+
+		/*
+		 *  Archetype: Chunked table of entities sharing a set of component types.
+		 *
+		 *  		   Rows are densely packed - removal moves the last row into the created hole.
+		 *  		   Row r lives in chunk (r / chunkCapacity), at position (r % chunkCapacity).
+		 */
+		class Archetype
+		{
+			using Chunk = std::unique_ptr<std::max_align_t[]>;
+		public:
+			static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+			Archetype(TypeList types) : _types(std::move(types)) {
+				for (const auto* type : _types)
+					_mask.set(type->index);
+
+				computeLayout();
+			}
+
+			Archetype(const Archetype&) = delete;
+			Archetype& operator=(const Archetype&) = delete;
+
+			~Archetype() {
+				while (_size > 0)
+					destroyRow(--_size);
+			}
+
+			std::size_t columnIndex(const std::type_index type) const {
+				for (std::size_t i = 0; i < _types.size(); ++i)
+				{
+					if (_types[i]->type == type)
+						return i;
+				}
+
+				return npos;
+			}
+
+			const TypeList& getTypes() const {
+				return _types;
+			}
+
+			const ComponentMask& getMask() const {
+				return _mask;
+			}
+
+			std::size_t getSize() const {
+				return _size;
+			}
+
+			std::size_t getChunkCapacity() const {
+				return _chunkCapacity;
+			}
+
+			std::size_t getChunkCount() const {
+				return _chunks.size();
+			}
+
+			/*
+			 *  pushRow(): Append a row owned by id, and return its index. Components in the row are left unconstructed.
+			 */
+			std::size_t pushRow(const EntityId id) {
+				if (_size == _chunks.size() * _chunkCapacity)
+				{
+					// Plain new[] default-initializes - chunk isn't zeroed, as components are placement-constructed over it anyway.
+					_chunks.emplace_back(new std::max_align_t[_chunkWords]);
+				}
+
+				entities(_size / _chunkCapacity)[_size % _chunkCapacity] = id;
+
+				return _size++;
+			}
+
+			/*
+			 *  popRow(): Drop last row, without destroying its components. Used to roll back pushRow().
+			 */
+			void popRow() {
+				--_size;
+				releaseSpareChunk();
+			}
+
+			/*
+			 *  removeRow(): Destroy components in row, and fill the hole with the last row.
+			 *
+			 *  Returns:
+			 *    - Id of entity which was moved into row, if any.
+			 */
+			std::optional<EntityId> removeRow(const std::size_t row) {
+				destroyRow(row);
+
+				const auto last = _size - 1;
+				std::optional<EntityId> movedEntity;
+
+				if (row != last)
+				{
+					for (std::size_t column = 0; column < _types.size(); ++column)
+					{
+						_types[column]->moveConstruct(at(column, row), at(column, last));
+						_types[column]->destroy(at(column, last));
+					}
+
+					movedEntity = entityAt(last);
+					entityAt(row) = *movedEntity;
+				}
+
+				popRow();
+
+				return movedEntity;
+			}
+
+			void* at(const std::size_t column, const std::size_t row) {
+				return columnData(row / _chunkCapacity, column) + (row % _chunkCapacity) * _types[column]->size;
+			}
+
+			EntityId& entityAt(const std::size_t row) {
+				return entities(row / _chunkCapacity)[row % _chunkCapacity];
+			}
+
+			std::byte* columnData(const std::size_t chunk, const std::size_t column) {
+				return chunkData(chunk) + _columnOffsets[column];
+			}
+
+			EntityId* entities(const std::size_t chunk) {
+				return reinterpret_cast<EntityId*>(chunkData(chunk));
+			}
+
+			// Spare chunk, kept after removals, holds no rows.
+			std::size_t rowsInChunk(const std::size_t chunk) const {
+				const auto firstRow = chunk * _chunkCapacity;
+
+				return (firstRow < _size) ? std::min(_chunkCapacity, _size - firstRow) : 0;
+			}
+
+			// Cache of archetypes reached by adding a single component type to this one.
+			std::unordered_map<std::type_index, Archetype*> addEdges;
+
+		private:
+			static std::size_t alignUp(const std::size_t offset, const std::size_t alignment) {
+				return (offset + alignment - 1) / alignment * alignment;
+			}
+
+			// Byte size of a chunk holding capacity rows, with entity ids column placed first.
+			std::size_t chunkBytes(const std::size_t capacity) const {
+				std::size_t offset = sizeof(EntityId) * capacity;
+
+				for (const auto* type : _types)
+					offset = alignUp(offset, type->alignment) + type->size * capacity;
+
+				return offset;
+			}
+
+			void computeLayout() {
+				std::size_t rowBytes = sizeof(EntityId);
+				for (const auto* type : _types)
+					rowBytes += type->size;
+
+				_chunkCapacity = std::max<std::size_t>(1, chunkSize / rowBytes);
+				while (_chunkCapacity > 1 && chunkBytes(_chunkCapacity) > chunkSize)
+					--_chunkCapacity;
+
+				std::size_t offset = sizeof(EntityId) * _chunkCapacity;
+				for (const auto* type : _types)
+				{
+					offset = alignUp(offset, type->alignment);
+					_columnOffsets.emplace_back(offset);
+					offset += type->size * _chunkCapacity;
+				}
+
+				_chunkWords = (std::max(offset, chunkSize) + sizeof(std::max_align_t) - 1) / sizeof(std::max_align_t);
+			}
+
+			std::byte* chunkData(const std::size_t chunk) {
+				return reinterpret_cast<std::byte*>(_chunks[chunk].get());
+			}
+
+			void destroyRow(const std::size_t row) {
+				for (std::size_t column = 0; column < _types.size(); ++column)
+					_types[column]->destroy(at(column, row));
+			}
+
+			// Keep at most one empty chunk around, so entities churning on a chunk boundary don't reallocate every time.
+			void releaseSpareChunk() {
+				if (_chunks.size() * _chunkCapacity >= _size + 2 * _chunkCapacity)
+					_chunks.pop_back();
+			}
+
+			TypeList				 _types;
+			ComponentMask			 _mask;
+			std::vector<std::size_t> _columnOffsets;
+			std::size_t				 _chunkCapacity = 1;
+			std::size_t				 _chunkWords = 0;
+
+			std::vector<Chunk>		 _chunks;
+			std::size_t				 _size = 0;
+		};
+
+		struct Location {
+			Archetype* archetype;
+			std::size_t row;
+		};
+
+	public:
+		/*
+		 *  insert(): Add all supplied components to entity.
+		 *  		  New entities are placed directly in the archetype of supplied components, without intermediate moves.
+		 *  		  Components entity already has are left untouched.
+		 */
+		template<typename... Cs>
+		void insert(const EntityId id, Cs&&... components) {
+			static_assert(boost::mp11::mp_is_set<boost::mp11::mp_list<std::decay_t<Cs>...>>::value,
+					"ECS::ArchetypeStorage::insert() failed: Component types must be unique.");
+
+			if (contains(id))
+			{
+				(add<std::decay_t<Cs>>(id, std::forward<Cs>(components)), ...);
+				return;
+			}
+
+			auto& archetype = findOrCreateArchetype({ componentType<std::decay_t<Cs>>()... });
+			const auto row = archetype.pushRow(id);
+			std::size_t constructedCount = 0;
+
+			try {
+				((constructInColumn<std::decay_t<Cs>>(archetype, row, std::forward<Cs>(components)), ++constructedCount), ...);
+			} catch (...) {
+				destroyInColumns<std::decay_t<Cs>...>(archetype, row, constructedCount);
+				archetype.popRow();
+				throw;
+			}
+
+			_locations.try_emplace(id, Location{ &archetype, row });
+		}
+
+		/*
+		 *  add(): Construct component C for entity, moving entity to archetype which includes C.
+		 *  	   Has no effect if entity already has C.
+		 */
+		template<typename C, typename... Args>
+		C& add(const EntityId id, Args&&... ctorArgs) {
+			const auto location = _locations.find(id);
+
+			if (location == std::end(_locations))
+			{
+				insert(id, makeComponent<C>(std::forward<Args>(ctorArgs)...));
+				return get<C>(id);
+			}
+
+			auto& source = *location->second.archetype;
+			const auto sourceRow = location->second.row;
+
+			if (source.columnIndex(typeid(C)) != Archetype::npos)
+				return get<C>(id);
+
+			auto& target = findAddTarget(source, componentType<C>());
+			const auto targetRow = target.pushRow(id);
+
+			try {
+				constructComponent<C>(target.at(target.columnIndex(typeid(C)), targetRow), std::forward<Args>(ctorArgs)...);
+			} catch (...) {
+				target.popRow();
+				throw;
+			}
+
+			for (std::size_t column = 0; column < source.getTypes().size(); ++column)
+			{
+				const auto* type = source.getTypes()[column];
+				type->moveConstruct(target.at(target.columnIndex(type->type), targetRow), source.at(column, sourceRow));
+			}
+
+			location->second = Location{ &target, targetRow };
+			eraseRow(source, sourceRow);
+
+			return *static_cast<C*>(target.at(target.columnIndex(typeid(C)), targetRow));
+		}
+
+		/*
+		 *  removeComponent(): Destroy entity's component C, moving entity to archetype without C.
+		 *  				   Entity left without components is removed. Has no effect if entity doesn't have C.
+		 */
+		template<typename C>
+		void removeComponent(const EntityId id) {
+			const auto location = _locations.find(id);
+			if (location == std::end(_locations))
+				return;
+
+			auto& source = *location->second.archetype;
+			const auto sourceRow = location->second.row;
+
+			const auto removedColumn = source.columnIndex(typeid(C));
+			if (removedColumn == Archetype::npos)
+				return;
+
+			if (source.getTypes().size() == 1)
+			{
+				remove(id);
+				return;
+			}
+
+			auto types = source.getTypes();
+			types.erase(std::begin(types) + removedColumn);
+
+			auto& target = findOrCreateArchetype(std::move(types));
+			const auto targetRow = target.pushRow(id);
+
+			for (std::size_t column = 0; column < source.getTypes().size(); ++column)
+			{
+				if (column == removedColumn)
+					continue;
+
+				const auto* type = source.getTypes()[column];
+				type->moveConstruct(target.at(target.columnIndex(type->type), targetRow), source.at(column, sourceRow));
+			}
+
+			location->second = Location{ &target, targetRow };
+			eraseRow(source, sourceRow);
+		}
+
+		// Iteration only matches existing archetypes, nothing to prepare.
+		template<typename C>
+		void prepare() {}
+
+		// Chunks are allocated on demand, nothing to reserve.
+		template<typename C>
+		void reserve(const std::size_t) {}
+
+		template<typename C>
+		bool has(const EntityId id) const {
+			const auto location = _locations.find(id);
+
+			return (location != std::cend(_locations)) && (location->second.archetype->columnIndex(typeid(C)) != Archetype::npos);
+		}
+
+		/*
+		 *  get(): Return reference to entity's component of type C.
+		 *
+		 *  Throws:
+		 *    - NotFoundError if entity doesn't have component C.
+		 */
+		template<typename C>
+		C& get(const EntityId id) {
+			const auto location = _locations.find(id);
+			if (location == std::end(_locations))
+				throw Exceptions::NotFoundError("ECS::ArchetypeStorage::get() failed: Entity doesn't exist.");
+
+			auto& [archetype, row] = location->second;
+
+			const auto column = archetype->columnIndex(typeid(C));
+			if (column == Archetype::npos)
+				throw Exceptions::NotFoundError("ECS::ArchetypeStorage::get() failed: Entity doesn't have requested component.");
+
+			return *static_cast<C*>(archetype->at(column, row));
+		}
+
+		template<typename C>
+		const C& get(const EntityId id) const {
+			return const_cast<ArchetypeStorage&>(*this).get<C>(id);
+		}
+
+		bool contains(const EntityId id) const {
+			return _locations.find(id) != std::cend(_locations);
+		}
+
+		std::size_t size() const {
+			return _locations.size();
+		}
+
+		std::size_t getArchetypeCount() const {
+			return _archetypes.size();
+		}
+
+		/*
+		 *  forEach(): Call func(id, C1&, C2&, ...) for every entity having all of Cs... components.
+		 *
+		 *  		   Archetypes are matched by their component masks, then visited one chunk at a time, walking each column linearly.
+		 *  		   func must not add or remove components / entities.
+		 */
+		template<typename... Cs, typename F>
+		void forEach(F&& func) {
+			const auto& required = ComponentMask::of<Cs...>();
+
+			for (auto& [_, archetype] : _archetypes)
+			{
+				if (!archetype->getMask().containsAll(required))
+					continue;
+
+				const std::size_t columns[] = { archetype->columnIndex(typeid(Cs))... };
+
+				forEachInArchetype<Cs...>(*archetype, columns, func, std::index_sequence_for<Cs...>());
+			}
+		}
+
+		void remove(const EntityId id) {
+			const auto location = _locations.find(id);
+			if (location == std::end(_locations))
+				return;
+
+			const auto [archetype, row] = location->second;
+
+			_locations.erase(location);
+			eraseRow(*archetype, row);
+		}
+
+	private:
+		template<typename... Cs, typename F, std::size_t... Is>
+		void forEachInArchetype(Archetype& archetype, const std::size_t* columns, F& func, std::index_sequence<Is...>) {
+			for (std::size_t chunk = 0; chunk < archetype.getChunkCount(); ++chunk)
+			{
+				const auto rows = archetype.rowsInChunk(chunk);
+				const auto* ids = archetype.entities(chunk);
+				const auto data = std::make_tuple(reinterpret_cast<Cs*>(archetype.columnData(chunk, columns[Is]))...);
+
+				for (std::size_t row = 0; row < rows; ++row)
+					func(ids[row], std::get<Is>(data)[row]...);
+			}
+		}
+
+		template<typename C, typename T>
+		static void constructInColumn(Archetype& archetype, const std::size_t row, T&& component) {
+			new (archetype.at(archetype.columnIndex(typeid(C)), row)) C(std::forward<T>(component));
+		}
+
+		// Destroy first count of Cs... components in row. Used to roll back a partially constructed insert().
+		template<typename... Cs>
+		static void destroyInColumns(Archetype& archetype, const std::size_t row, const std::size_t count) {
+			std::size_t index = 0;
+
+			((index++ < count ? componentType<Cs>()->destroy(archetype.at(archetype.columnIndex(typeid(Cs)), row)) : void()), ...);
+		}
+
+		// Remove row, and update location of entity moved into its place.
+		void eraseRow(Archetype& archetype, const std::size_t row) {
+			if (const auto movedEntity = archetype.removeRow(row))
+				_locations.at(*movedEntity).row = row;
+		}
+
+		Archetype& findAddTarget(Archetype& source, const ComponentType* added) {
+			const auto edge = source.addEdges.find(added->type);
+			if (edge != std::end(source.addEdges))
+				return *edge->second;
+
+			auto types = source.getTypes();
+			types.emplace_back(added);
+
+			auto& target = findOrCreateArchetype(std::move(types));
+			source.addEdges.try_emplace(added->type, &target);
+
+			return target;
+		}
+
+		Archetype& findOrCreateArchetype(TypeList types) {
+			std::sort(std::begin(types), std::end(types), [ ] ( const auto* lhs, const auto* rhs ) { return lhs->type < rhs->type; });
+
+			Signature signature;
+			for (const auto* type : types)
+				signature.emplace_back(type->type);
+
+			auto& archetype = _archetypes[std::move(signature)];
+			if (!archetype)
+				archetype = std::make_unique<Archetype>(std::move(types));
+
+			return *archetype;
+		}
+
+		std::map<Signature, std::unique_ptr<Archetype>> _archetypes;
+		std::unordered_map<EntityId, Location>			_locations;
+	};
+}
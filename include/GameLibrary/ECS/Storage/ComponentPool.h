@@ -0,0 +1,437 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "GameLibrary/ECS/Component.h"
+#include "GameLibrary/ECS/EntityId.h"
+#include "GameLibrary/ECS/MemoryStats.h"
+#include "GameLibrary/Exceptions/Standard.h"
+
+
+namespace GameLibrary::ECS
+{
+	/*
+	 *  ChangeTick: Value of storage's change counter, stamped on components when they are added or changed.
+	 *  			Components changed after tick t are the ones stamped with a tick greater than t.
+	 */
+	using ChangeTick = std::uint64_t;
+
+	/*
+	 *  ChangeLog: Entities stamped with a tick, in order of stamping - allows visiting changes made since a tick
+	 *  		   at cost proportional to count of changes, instead of pool size.
+	 *
+	 *  		   Entries outdated by a later stamp of the same entity (or by its removal) are skipped, and dropped on compaction.
+	 *  		   Entity stamped again with the same tick (e.g. component removed and added back within a tick) is logged once.
+	 */
+	class ChangeLog
+	{
+	public:
+		void append(const EntityId id, const ChangeTick tick) {
+			const auto index = getEntityIndex(id);
+
+			if (index >= _lastEntries.size())
+				_lastEntries.resize(index + 1);
+
+			// Such entry would be current along with the existing one - visiting the entity twice.
+			auto& last = _lastEntries[index];
+			if (last.id == id && last.tick == tick)
+				return;
+
+			last = { id, tick };
+			_entries.push_back({ id, tick });
+		}
+
+		/*
+		 *  forEachSince(): Call func(id) for every entity stamped after tick since, whose current tick (as reported
+		 *  				by currentTickOf(id)) is still the logged one. Entries appended by func are not visited.
+		 */
+		template<typename T, typename F>
+		void forEachSince(const ChangeTick since, T&& currentTickOf, F&& func) const {
+			const auto first = std::partition_point(std::cbegin(_entries), std::cend(_entries), [ since ] ( const Entry& entry ) {
+				return entry.tick <= since;
+			});
+			const auto end = _entries.size();
+
+			// Indices, as func may append entries (and reallocate). Compaction is held off until iteration ends.
+			++_iterationDepth;
+			try {
+				for (auto i = static_cast<std::size_t>(first - std::cbegin(_entries)); i < end; ++i)
+				{
+					const auto entry = _entries[i];
+
+					if (currentTickOf(entry.id) == entry.tick)
+						func(entry.id);
+				}
+			} catch (...) {
+				--_iterationDepth;
+				throw;
+			}
+			--_iterationDepth;
+		}
+
+		/*
+		 *  compact(): Drop entries which are no longer current, if they make up most of the log.
+		 */
+		template<typename T>
+		void compact(const std::size_t liveCount, T&& currentTickOf) {
+			constexpr std::size_t minCompactedSize = 64;
+
+			if (_iterationDepth > 0 || _entries.size() <= std::max(minCompactedSize, 2 * liveCount))
+				return;
+
+			_entries.erase(std::remove_if(std::begin(_entries), std::end(_entries), [ this, &currentTickOf ] ( const Entry& entry ) {
+				if (currentTickOf(entry.id) == entry.tick)
+					return false;
+
+				// Entity may be stamped with this tick again, and has to be logged anew then.
+				auto& last = _lastEntries[getEntityIndex(entry.id)];
+				if (last.id == entry.id && last.tick == entry.tick)
+					last = {};
+
+				return true;
+			}), std::end(_entries));
+		}
+
+		std::size_t size() const {
+			return _entries.size();
+		}
+
+		void clear() {
+			_entries.clear();
+			_lastEntries.clear();
+		}
+
+		void reserve(const std::size_t capacity) {
+			_entries.reserve(capacity);
+		}
+
+		void addMemoryUsage(MemoryUsage& usage) const {
+			addVectorUsage(usage, _entries);
+			addVectorUsage(usage, _lastEntries);
+		}
+
+	private:
+		struct Entry {
+			EntityId id;
+			ChangeTick tick = 0;
+		};
+
+		std::vector<Entry>	_entries;
+		// Indexed by entity index, last entry appended for the slot.
+		std::vector<Entry>	_lastEntries;
+		mutable std::size_t _iterationDepth = 0;
+	};
+
+	/*
+	 *  BasePool: Type-erased interface of ComponentPool<C>, used for operations not depending on component type.
+	 */
+	class BasePool
+	{
+	public:
+		virtual ~BasePool() = default;
+
+		virtual bool contains(const EntityId id) const = 0;
+		virtual void remove(const EntityId id) = 0;
+		virtual void clear() = 0;
+		virtual std::size_t size() const = 0;
+
+		/*
+		 *  getMemoryUsage(): Return memory held by the pool, named after its component type.
+		 */
+		virtual MemoryUsage getMemoryUsage() const = 0;
+	};
+
+	/*
+	 *  ComponentPool: Sparse set of components of type C.
+	 *
+	 *  			   Sparse array maps entity index to position in dense arrays, which hold owning entities and components side by side.
+	 *  			   Add, remove, contains and get are constant time, dense arrays have no gaps (removal swaps with last element).
+	 *  			   Removal and addition invalidate references to components, and change their order.
+	 *  			   Components are stored by value - any move-constructible and move-assignable type works, no base class required.
+	 *
+	 *  			   Each component carries ticks of its addition and last change, read from currentTick supplied by owning storage.
+	 *  			   Changes are only recorded by emplace() and markChanged() - writes through plain references are not tracked.
+	 */
+	template<typename C>
+	class ComponentPool : public BasePool
+	{
+		static_assert(std::is_move_constructible_v<C> && std::is_move_assignable_v<C>,
+				"ECS::ComponentPool: Components must be move-constructible and move-assignable.");
+	public:
+		using Component = C;
+
+		static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+		// Tick reported for entities without a component in this pool.
+		static constexpr ChangeTick noTick = static_cast<ChangeTick>(-1);
+
+		/*
+		 *  ComponentPool(): Construct empty pool, stamping changes with value of currentTick (0 if nullptr).
+		 *  				 currentTick must outlive the pool.
+		 */
+		explicit ComponentPool(const ChangeTick* currentTick = nullptr) : _currentTick(currentTick) {}
+
+		/*
+		 *  emplace(): Construct component for entity from ctorArgs.
+		 *  		   Has no effect if entity already has a component in this pool.
+		 *
+		 *  Returns:
+		 *    - Reference to entity's component.
+		 */
+		template<typename... Args>
+		C& emplace(const EntityId id, Args&&... ctorArgs) {
+			const auto index = getEntityIndex(id);
+
+			if (index >= _sparse.size())
+				_sparse.resize(index + 1, npos);
+			else if (_sparse[index] != npos)
+				return _components[_sparse[index]];
+
+			_components.emplace_back(makeComponent<C>(std::forward<Args>(ctorArgs)...));
+
+			_sparse[index] = _entities.size();
+			_entities.emplace_back(id);
+
+			const auto tick = getCurrentTick();
+			_addedTicks.emplace_back(tick);
+			_changedTicks.emplace_back(tick);
+			appendToLog(_addedLog, _addedTicks, id, tick);
+			appendToLog(_changedLog, _changedTicks, id, tick);
+
+			return _components.back();
+		}
+
+		/*
+		 *  assign(): Replace pool's content with count components copied from arrays, all stamped as added at current tick.
+		 *  		  Entities must be unique. Dense arrays are filled by a single copy each, with no per-component work.
+		 */
+		void assign(const EntityId* entities, const C* components, const std::size_t count) {
+			static_assert(std::is_copy_constructible_v<C>, "ECS::ComponentPool::assign(): Components must be copy-constructible.");
+
+			_entities.assign(entities, entities + count);
+			_components.assign(components, components + count);
+
+			const auto tick = getCurrentTick();
+			_addedTicks.assign(count, tick);
+			_changedTicks.assign(count, tick);
+
+			std::size_t sparseSize = _sparse.size();
+			for (std::size_t i = 0; i < count; ++i)
+				sparseSize = std::max(sparseSize, getEntityIndex(entities[i]) + 1);
+			_sparse.assign(sparseSize, npos);
+
+			_addedLog.clear();
+			_changedLog.clear();
+			_addedLog.reserve(count);
+			_changedLog.reserve(count);
+
+			for (std::size_t i = 0; i < count; ++i)
+			{
+				_sparse[getEntityIndex(entities[i])] = i;
+				_addedLog.append(entities[i], tick);
+				_changedLog.append(entities[i], tick);
+			}
+		}
+
+		/*
+		 *  markChanged(): Stamp entity's component with current tick. Has no effect if there is none.
+		 */
+		void markChanged(const EntityId id) {
+			const auto position = find(id);
+			const auto tick = getCurrentTick();
+
+			if (position == npos || _changedTicks[position] == tick)
+				return;
+
+			_changedTicks[position] = tick;
+			appendToLog(_changedLog, _changedTicks, id, tick);
+		}
+
+		ChangeTick getAddedTick(const EntityId id) const {
+			const auto position = find(id);
+			return (position != npos) ? _addedTicks[position] : noTick;
+		}
+
+		ChangeTick getChangedTick(const EntityId id) const {
+			const auto position = find(id);
+			return (position != npos) ? _changedTicks[position] : noTick;
+		}
+
+		/*
+		 *  forEachAdded(): Call func(id) for every entity whose component was added after tick since.
+		 *  				func must not add or remove components of this pool.
+		 */
+		template<typename F>
+		void forEachAdded(const ChangeTick since, F&& func) const {
+			_addedLog.forEachSince(since, [ this ] ( const EntityId id ) { return getAddedTick(id); }, std::forward<F>(func));
+		}
+
+		/*
+		 *  forEachChanged(): Call func(id) for every entity whose component was added or changed after tick since.
+		 *  				  func must not add or remove components of this pool.
+		 */
+		template<typename F>
+		void forEachChanged(const ChangeTick since, F&& func) const {
+			_changedLog.forEachSince(since, [ this ] ( const EntityId id ) { return getChangedTick(id); }, std::forward<F>(func));
+		}
+
+		ChangeTick getCurrentTick() const {
+			return _currentTick ? *_currentTick : 0;
+		}
+
+		virtual bool contains(const EntityId id) const override {
+			return find(id) != npos;
+		}
+
+		/*
+		 *  get(): Return reference to entity's component.
+		 *
+		 *  Throws:
+		 *    - NotFoundError if entity has no component in this pool.
+		 */
+		C& get(const EntityId id) {
+			const auto position = find(id);
+			if (position == npos)
+				throw Exceptions::NotFoundError("ECS::ComponentPool::get() failed: Entity doesn't have requested component.");
+
+			return _components[position];
+		}
+
+		const C& get(const EntityId id) const {
+			return const_cast<ComponentPool&>(*this).get(id);
+		}
+
+		/*
+		 *  find(): Return position of entity's component in dense arrays, or npos if entity has no component in this pool.
+		 */
+		std::size_t find(const EntityId id) const {
+			const auto index = getEntityIndex(id);
+
+			if (index >= _sparse.size())
+				return npos;
+
+			const auto position = _sparse[index];
+
+			return (position != npos && _entities[position] == id) ? position : npos;
+		}
+
+		/*
+		 *  remove(): Destroy entity's component, moving last component into its place. Has no effect if there is none.
+		 */
+		virtual void remove(const EntityId id) override {
+			const auto position = find(id);
+			if (position == npos)
+				return;
+
+			const auto last = _entities.size() - 1;
+
+			if (position != last)
+			{
+				_components[position] = std::move(_components[last]);
+				_entities[position] = _entities[last];
+				_addedTicks[position] = _addedTicks[last];
+				_changedTicks[position] = _changedTicks[last];
+				_sparse[getEntityIndex(_entities[position])] = position;
+			}
+
+			_components.pop_back();
+			_entities.pop_back();
+			_addedTicks.pop_back();
+			_changedTicks.pop_back();
+			_sparse[getEntityIndex(id)] = npos;
+		}
+
+		/*
+		 *  clear(): Destroy all components. Capacity is kept.
+		 */
+		virtual void clear() override {
+			_sparse.assign(_sparse.size(), npos);
+			_entities.clear();
+			_components.clear();
+			_addedTicks.clear();
+			_changedTicks.clear();
+			_addedLog.clear();
+			_changedLog.clear();
+		}
+
+		virtual std::size_t size() const override {
+			return _entities.size();
+		}
+
+		virtual MemoryUsage getMemoryUsage() const override {
+			MemoryUsage usage{ componentName<C>(), size() };
+
+			// Only slots pointing at components are used - the rest are gaps left by entities without one.
+			addVectorUsage(usage, _sparse, size());
+			addVectorUsage(usage, _entities);
+			addVectorUsage(usage, _components);
+			addVectorUsage(usage, _addedTicks);
+			addVectorUsage(usage, _changedTicks);
+			_addedLog.addMemoryUsage(usage);
+			_changedLog.addMemoryUsage(usage);
+
+			return usage;
+		}
+
+		/*
+		 *  swapPositions(): Exchange places of two components (and their entities and ticks) in dense arrays.
+		 *  				 Used by OwningGroup to keep grouped entities at the front of the pool.
+		 */
+		void swapPositions(const std::size_t first, const std::size_t second) {
+			if (first == second)
+				return;
+
+			using std::swap;
+			swap(_components[first], _components[second]);
+			swap(_entities[first], _entities[second]);
+			swap(_addedTicks[first], _addedTicks[second]);
+			swap(_changedTicks[first], _changedTicks[second]);
+
+			_sparse[getEntityIndex(_entities[first])] = first;
+			_sparse[getEntityIndex(_entities[second])] = second;
+		}
+
+		void reserve(const std::size_t capacity) {
+			_entities.reserve(capacity);
+			_components.reserve(capacity);
+			_addedTicks.reserve(capacity);
+			_changedTicks.reserve(capacity);
+		}
+
+		const std::vector<EntityId>& getEntities() const {
+			return _entities;
+		}
+
+		std::vector<C>& getComponents() {
+			return _components;
+		}
+
+		const std::vector<C>& getComponents() const {
+			return _components;
+		}
+
+	private:
+		void appendToLog(ChangeLog& log, const std::vector<ChangeTick>& ticks, const EntityId id, const ChangeTick tick) {
+			// Compacting first keeps the log from outgrowing the pool, however often components change.
+			log.compact(size(), [ this, &ticks ] ( const EntityId logged ) {
+				const auto position = find(logged);
+				return (position != npos) ? ticks[position] : noTick;
+			});
+			log.append(id, tick);
+		}
+
+		std::vector<std::size_t> _sparse;
+		std::vector<EntityId>	 _entities;
+		std::vector<C>			 _components;
+
+		std::vector<ChangeTick>	 _addedTicks;
+		std::vector<ChangeTick>	 _changedTicks;
+		ChangeLog				 _addedLog;
+		ChangeLog				 _changedLog;
+		const ChangeTick*		 _currentTick;
+	};
+}
@@ -0,0 +1,191 @@
+#pragma once
+
+#include <map>
+#include <memory>
+#include <set>
+#include <typeindex>
+
+#include "GameLibrary/ECS/Component.h"
+#include "GameLibrary/ECS/EntityId.h"
+#include "GameLibrary/Exceptions/Standard.h"
+
+
+namespace GameLibrary::ECS
+{
+	/*
+	 *  MapStorage: Component storage keeping components by value in an ordered map per component type.
+	 *
+	 *  			Simple, but every access costs two tree lookups.
+	 */
+	class MapStorage
+	{
+		/*
+		 *  BaseComponentMap: Type-erased interface of TypedComponentMap<C>, used for operations not depending on component type.
+		 */
+		class BaseComponentMap
+		{
+		public:
+			virtual ~BaseComponentMap() = default;
+
+			virtual bool contains(const EntityId id) const = 0;
+			virtual void erase(const EntityId id) = 0;
+			virtual void collectIds(std::set<EntityId>& ids) const = 0;
+		};
+
+		template<typename C>
+		class TypedComponentMap : public BaseComponentMap
+		{
+		public:
+			virtual bool contains(const EntityId id) const override {
+				return components.find(id) != std::cend(components);
+			}
+
+			virtual void erase(const EntityId id) override {
+				components.erase(id);
+			}
+
+			virtual void collectIds(std::set<EntityId>& ids) const override {
+				for (const auto& [id, _] : components)
+					ids.emplace(id);
+			}
+
+			std::map<EntityId, C> components;
+		};
+
+	public:
+		template<typename C>
+		using ComponentMap = std::map<EntityId, C>;
+
+		/*
+		 *  insert(): Add all supplied components to entity. Components entity already has are left untouched.
+		 */
+		template<typename... Cs>
+		void insert(const EntityId id, Cs&&... components) {
+			(add<std::decay_t<Cs>>(id, std::forward<Cs>(components)), ...);
+		}
+
+		template<typename C, typename... Args>
+		C& add(const EntityId id, Args&&... ctorArgs) {
+			auto& componentMap = getComponents<C>();
+
+			auto component = componentMap.find(id);
+			if (component == std::end(componentMap))
+				component = componentMap.try_emplace(id, makeComponent<C>(std::forward<Args>(ctorArgs)...)).first;
+
+			return component->second;
+		}
+
+		// Maps allocate per node, nothing to reserve.
+		template<typename C>
+		void reserve(const std::size_t) {}
+
+		template<typename C>
+		bool has(const EntityId id) const {
+			const auto componentMap = _components.find(typeid(C));
+
+			return (componentMap != std::cend(_components)) && componentMap->second->contains(id);
+		}
+
+		/*
+		 *  get(): Return reference to entity's component of type C.
+		 *
+		 *  Throws:
+		 *    - NotFoundError if entity doesn't have component C.
+		 */
+		template<typename C>
+		C& get(const EntityId id) {
+			auto& componentMap = getComponents<C>();
+
+			const auto component = componentMap.find(id);
+			if (component == std::end(componentMap))
+				throw Exceptions::NotFoundError("ECS::MapStorage::get() failed: Entity doesn't have requested component.");
+
+			return component->second;
+		}
+
+		template<typename C>
+		const C& get(const EntityId id) const {
+			const auto componentMap = _components.find(typeid(C));
+
+			if (componentMap != std::cend(_components))
+			{
+				const auto& components = static_cast<const TypedComponentMap<C>&>(*componentMap->second).components;
+
+				const auto component = components.find(id);
+				if (component != std::cend(components))
+					return component->second;
+			}
+
+			throw Exceptions::NotFoundError("ECS::MapStorage::get() failed: Entity doesn't have requested component.");
+		}
+
+		bool contains(const EntityId id) const {
+			for (const auto& [_, componentMap] : _components)
+			{
+				if (componentMap->contains(id))
+					return true;
+			}
+
+			return false;
+		}
+
+		std::size_t size() const {
+			std::set<EntityId> foundIds;
+
+			for (const auto& [_, componentMap] : _components)
+				componentMap->collectIds(foundIds);
+
+			return foundIds.size();
+		}
+
+		/*
+		 *  getComponents(): Return map of entities to their components of type C, creating it if it doesn't exist yet.
+		 */
+		template<typename C>
+		ComponentMap<C>& getComponents() {
+			auto& componentMap = _components[typeid(C)];
+
+			if (!componentMap)
+				componentMap = std::make_unique<TypedComponentMap<C>>();
+
+			return static_cast<TypedComponentMap<C>&>(*componentMap).components;
+		}
+
+		/*
+		 *  prepare(): Create map of components of type C, if it doesn't exist yet.
+		 *  		   Afterwards, iterating C doesn't modify the storage, so it may be done concurrently.
+		 */
+		template<typename C>
+		void prepare() {
+			getComponents<C>();
+		}
+
+		/*
+		 *  forEach(): Call func(id, C1&, C2&, ...) for every entity having all of Cs... components.
+		 */
+		template<typename C, typename... Cs, typename F>
+		void forEach(F&& func) {
+			for (auto& [id, component] : getComponents<C>())
+			{
+				if ((has<Cs>(id) && ...))
+					func(id, component, get<Cs>(id)...);
+			}
+		}
+
+		template<typename C>
+		void removeComponent(const EntityId id) {
+			const auto componentMap = _components.find(typeid(C));
+
+			if (componentMap != std::end(_components))
+				componentMap->second->erase(id);
+		}
+
+		void remove(const EntityId id) {
+			for (auto& [_, componentMap] : _components)
+				componentMap->erase(id);
+		}
+
+	private:
+		std::map<std::type_index, std::unique_ptr<BaseComponentMap>> _components;
+	};
+}
@@ -0,0 +1,395 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+#include "GameLibrary/ECS/Component.h"
+#include "GameLibrary/ECS/EntityId.h"
+#include "GameLibrary/ECS/Group.h"
+#include "GameLibrary/ECS/MemoryStats.h"
+#include "GameLibrary/ECS/Storage/ComponentPool.h"
+#include "GameLibrary/ECS/Storage/TagPool.h"
+#include "GameLibrary/ECS/View.h"
+#include "GameLibrary/Exceptions/Standard.h"
+
+
+namespace GameLibrary::ECS
+{
+	/*
+	 *  SparseSetStorage: Component storage keeping one ComponentPool (sparse set) per component type.
+	 *
+	 *  				  Pools are indexed by componentIndex<C>(), so finding a pool is an array access.
+	 *  				  Tag components (empty types) get a TagPool - a bitset instead of dense arrays.
+	 *  				  Per-entity component counts make contains() and size() constant time.
+	 *  				  Components are stamped with storage's current tick when added, changed through get() or marked with markChanged().
+	 *  				  Pools may be owned by groups (see group()), which are kept packed on every add / remove made through the storage.
+	 */
+	class SparseSetStorage
+	{
+	public:
+		/*
+		 *  insert(): Add all supplied components to entity. Components entity already has are left untouched.
+		 */
+		template<typename... Cs>
+		void insert(const EntityId id, Cs&&... components) {
+			(add<std::decay_t<Cs>>(id, std::forward<Cs>(components)), ...);
+		}
+
+		template<typename C, typename... Args>
+		C& add(const EntityId id, Args&&... ctorArgs) {
+			auto& pool = getPool<C>();
+			const auto sizeBefore = pool.size();
+
+			auto& component = pool.emplace(id, std::forward<Args>(ctorArgs)...);
+
+			if (pool.size() == sizeBefore)
+				return component;
+
+			onComponentAdded(id);
+
+			if (auto* group = findOwningGroup(componentIndex<C>()))
+			{
+				group->onComponentAdded(id);
+				return pool.get(id);
+			}
+
+			return component;
+		}
+
+		/*
+		 *  assign(): Give components of type C to count entities at once, copying them from arrays (components are ignored for tags).
+		 *  		  Meant for bulk loading, e.g. from a Snapshot - pool is filled with a single copy, and entities are then
+		 *  		  moved into owning group if C's pool is owned.
+		 *
+		 *  Throws:
+		 *    - InvalidArgument if pool of C isn't empty.
+		 */
+		template<typename C>
+		void assign(const EntityId* entities, const C* components, const std::size_t count) {
+			auto& pool = getPool<C>();
+			if (pool.size() > 0)
+				throw Exceptions::InvalidArgument("ECS::SparseSetStorage::assign() failed: Component pool isn't empty.");
+
+			if constexpr (isTagComponent<C>)
+			{
+				for (std::size_t i = 0; i < count; ++i)
+					pool.emplace(entities[i]);
+			}
+			else
+				pool.assign(entities, components, count);
+
+			std::size_t countsSize = _componentCounts.size();
+			for (std::size_t i = 0; i < count; ++i)
+				countsSize = std::max(countsSize, getEntityIndex(entities[i]) + 1);
+			_componentCounts.resize(countsSize, 0);
+
+			for (std::size_t i = 0; i < count; ++i)
+				onComponentAdded(entities[i]);
+
+			if (auto* group = findOwningGroup(componentIndex<C>()))
+			{
+				for (std::size_t i = 0; i < count; ++i)
+					group->onComponentAdded(entities[i]);
+			}
+		}
+
+		/*
+		 *  reserve(): Make room for additional components of type C, so adding them doesn't reallocate.
+		 */
+		template<typename C>
+		void reserve(const std::size_t additional) {
+			auto& pool = getPool<C>();
+			pool.reserve(pool.size() + additional);
+		}
+
+		template<typename C>
+		bool has(const EntityId id) const {
+			const auto* pool = findPool<C>();
+
+			return pool && pool->contains(id);
+		}
+
+		/*
+		 *  get(): Return reference to entity's component of type C, marking it changed.
+		 *
+		 *  Throws:
+		 *    - NotFoundError if entity doesn't have component C.
+		 */
+		template<typename C>
+		C& get(const EntityId id) {
+			auto& pool = getPool<C>();
+			auto& component = pool.get(id);
+
+			pool.markChanged(id);
+
+			return component;
+		}
+
+		/*
+		 *  get(): Return const reference to entity's component of type C, without marking it changed.
+		 *  	   Writes nothing, so concurrent readers don't race.
+		 *
+		 *  Throws:
+		 *    - NotFoundError if entity doesn't have component C.
+		 */
+		template<typename C>
+		const C& get(const EntityId id) const {
+			const auto* pool = findPool<C>();
+			if (!pool)
+				throw Exceptions::NotFoundError("ECS::SparseSetStorage::get() failed: Entity doesn't have requested component.");
+
+			return pool->get(id);
+		}
+
+		/*
+		 *  markChanged(): Stamp entity's component of type C with current tick. Has no effect if there is none.
+		 */
+		template<typename C>
+		void markChanged(const EntityId id) {
+			getPool<C>().markChanged(id);
+		}
+
+		ChangeTick getTick() const {
+			return *_tick;
+		}
+
+		/*
+		 *  advanceTick(): Start a new tick, and return the previous one.
+		 *  			   Changes made from now on are reported as made after the returned tick.
+		 */
+		ChangeTick advanceTick() {
+			return (*_tick)++;
+		}
+
+		/*
+		 *  contains(): Check if entity's slot holds any components.
+		 *  			Handle generations are not compared - validating handles is EntityManager's job.
+		 */
+		bool contains(const EntityId id) const {
+			const auto index = getEntityIndex(id);
+
+			return (index < _componentCounts.size()) && (_componentCounts[index] > 0);
+		}
+
+		std::size_t size() const {
+			return _entityCount;
+		}
+
+		/*
+		 *  getPool(): Return pool of components of type C, creating it if it doesn't exist yet.
+		 */
+		template<typename C>
+		PoolFor<C>& getPool() {
+			const auto index = componentIndex<C>();
+
+			if (index >= _pools.size())
+				_pools.resize(index + 1);
+
+			if (!_pools[index])
+				_pools[index] = std::make_unique<PoolFor<C>>(_tick.get());
+
+			return static_cast<PoolFor<C>&>(*_pools[index]);
+		}
+
+		/*
+		 *  findPool(): Return pointer to pool of components of type C, or nullptr if it doesn't exist.
+		 */
+		template<typename C>
+		const PoolFor<C>* findPool() const {
+			const auto index = componentIndex<C>();
+
+			return (index < _pools.size()) ? static_cast<const PoolFor<C>*>(_pools[index].get()) : nullptr;
+		}
+
+		/*
+		 *  prepare(): Create pool of components of type C, if it doesn't exist yet.
+		 *  		   Afterwards, views of C don't modify the storage, so they may be created concurrently.
+		 */
+		template<typename C>
+		void prepare() {
+			getPool<C>();
+		}
+
+		template<typename C>
+		PoolFor<C>& getComponents() {
+			return getPool<C>();
+		}
+
+		/*
+		 *  view(): Return View of entities having all of Cs... components, and none of Es... components.
+		 */
+		template<typename... Cs, typename... Es>
+		View<Exclude<Es...>, Cs...> view(Exclude<Es...> = {}) {
+			return View<Exclude<Es...>, Cs...>(getPool<Cs>()..., findPool<Es>()...);
+		}
+
+		/*
+		 *  forEach(): Call func(id, C1&, C2&, ...) for every entity having all of Cs... components.
+		 *  		   Walks the smallest of requested pools, looking up remaining components by id.
+		 */
+		template<typename... Cs, typename F>
+		void forEach(F&& func) {
+			view<Cs...>().forEach(std::forward<F>(func));
+		}
+
+		/*
+		 *  group(): Return Group of entities having all of Owned... components, creating its OwningGroup on first call.
+		 *  		 Owned pools are rearranged right away, and kept arranged from then on.
+		 *
+		 *  		 Example: storage.group<Position, Velocity>()
+		 *
+		 *  Throws:
+		 *    - InvalidArgument if any of Owned... pools is already owned by a different group (including same types in different order).
+		 */
+		template<typename... Owned>
+		Group<Owned...> group() {
+			const std::array<std::size_t, sizeof...(Owned)> indices{ componentIndex<Owned>()... };
+
+			if (auto* existing = findOwningGroup(indices[0]))
+			{
+				if (auto* group = dynamic_cast<OwningGroup<Owned...>*>(existing))
+					return Group<Owned...>(*group);
+			}
+
+			for (const auto index : indices)
+			{
+				if (findOwningGroup(index))
+					throw Exceptions::InvalidArgument("ECS::SparseSetStorage::group() failed: Component pool is already owned by another group.");
+			}
+
+			auto group = std::make_unique<OwningGroup<Owned...>>(getPool<Owned>()...);
+			auto& result = *group;
+
+			for (const auto index : indices)
+			{
+				if (index >= _owningGroups.size())
+					_owningGroups.resize(index + 1, nullptr);
+
+				_owningGroups[index] = group.get();
+			}
+			_groups.emplace_back(std::move(group));
+
+			return Group<Owned...>(result);
+		}
+
+		/*
+		 *  removeComponent(): Destroy entity's component of type C. id must refer to a live entity - tags are kept per slot,
+		 *  				   so a stale handle would remove the tag of the entity now occupying its slot.
+		 */
+		template<typename C>
+		void removeComponent(const EntityId id) {
+			auto* pool = findMutablePool(componentIndex<C>());
+
+			if (pool && pool->contains(id))
+			{
+				if (auto* group = findOwningGroup(componentIndex<C>()))
+					group->onComponentRemoving(id);
+
+				pool->remove(id);
+				onComponentRemoved(id);
+			}
+		}
+
+		/*
+		 *  remove(): Destroy all of entity's components. id must refer to a live entity - storage doesn't track generations,
+		 *  		  and tag pools are kept per slot, so a stale handle would strip tags of the entity now occupying its slot
+		 *  		  (EntityManager checks handles before calling this).
+		 */
+		void remove(const EntityId id) {
+			if (!contains(id))
+				return;
+
+			for (auto& group : _groups)
+				group->onComponentRemoving(id);
+
+			bool removedAny = false;
+			for (auto& pool : _pools)
+			{
+				if (pool && pool->contains(id))
+				{
+					pool->remove(id);
+					removedAny = true;
+				}
+			}
+
+			if (removedAny)
+			{
+				_componentCounts[getEntityIndex(id)] = 0;
+				--_entityCount;
+			}
+		}
+
+		/*
+		 *  clear(): Remove all components of all entities. Pools, groups and their capacity are kept.
+		 */
+		void clear() {
+			for (auto& pool : _pools)
+			{
+				if (pool)
+					pool->clear();
+			}
+
+			for (auto& group : _groups)
+				group->clear();
+
+			_componentCounts.clear();
+			_entityCount = 0;
+		}
+
+		/*
+		 *  collectMemoryStats(): Fill storage and components (one entry per existing pool) fields of stats.
+		 */
+		void collectMemoryStats(MemoryStats& stats) const {
+			stats.storage = MemoryUsage{ "storage", _entityCount };
+			addVectorUsage(stats.storage, _componentCounts);
+			addVectorUsage(stats.storage, _pools);
+			addVectorUsage(stats.storage, _owningGroups);
+
+			stats.components.clear();
+			for (const auto& pool : _pools)
+			{
+				if (pool)
+					stats.components.emplace_back(pool->getMemoryUsage());
+			}
+		}
+
+	private:
+		BasePool* findMutablePool(const std::size_t index) {
+			return (index < _pools.size()) ? _pools[index].get() : nullptr;
+		}
+
+		BaseOwningGroup* findOwningGroup(const std::size_t index) const {
+			return (index < _owningGroups.size()) ? _owningGroups[index] : nullptr;
+		}
+
+		void onComponentAdded(const EntityId id) {
+			const auto index = getEntityIndex(id);
+
+			if (index >= _componentCounts.size())
+				_componentCounts.resize(index + 1, 0);
+
+			if (_componentCounts[index]++ == 0)
+				++_entityCount;
+		}
+
+		void onComponentRemoved(const EntityId id) {
+			if (--_componentCounts[getEntityIndex(id)] == 0)
+				--_entityCount;
+		}
+
+		std::vector<std::unique_ptr<BasePool>> _pools;
+		// Heap-allocated, so pools keep pointing to it when storage is moved.
+		std::unique_ptr<ChangeTick>			   _tick = std::make_unique<ChangeTick>(1);
+
+		std::vector<std::size_t>			   _componentCounts;
+		std::size_t							   _entityCount = 0;
+
+		std::vector<std::unique_ptr<BaseOwningGroup>> _groups;
+		// Indexed by componentIndex(), group owning the pool or nullptr.
+		std::vector<BaseOwningGroup*>				  _owningGroups;
+	};
+}
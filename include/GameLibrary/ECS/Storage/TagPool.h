@@ -0,0 +1,162 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#include "GameLibrary/ECS/EntityId.h"
+#include "GameLibrary/ECS/MemoryStats.h"
+#include "GameLibrary/ECS/Storage/ComponentPool.h"
+#include "GameLibrary/Exceptions/Standard.h"
+
+
+namespace GameLibrary::ECS
+{
+	/*
+	 *  isTagComponent: Check if C is a tag - an empty type, marking entities without holding any data (e.g. Enemy, Dead).
+	 */
+	template<typename C>
+	inline constexpr bool isTagComponent = std::is_empty_v<C>;
+
+	/*
+	 *  TagPool: Set of entities having tag component C, kept as a bitset indexed by entity index.
+	 *
+	 *  		 Uses one bit per entity slot, and no per-entity allocations. All entities share a single C instance.
+	 *  		 Bits are per slot, not per handle - validating handle generations is the owner's job (as with SparseSetStorage::contains()).
+	 *  		 Tag pools can't drive View iteration (they hold no entity list), use forEachSetIndex() with word-wide operations instead.
+	 */
+	template<typename C>
+	class TagPool : public BasePool
+	{
+		static_assert(isTagComponent<C>, "ECS::TagPool: Tag components must be empty types.");
+	public:
+		using Component = C;
+		using Word = std::uint64_t;
+		static constexpr std::size_t wordBits = 64;
+
+		TagPool() = default;
+		// Tags carry no changes to track, tick is accepted for interface parity with ComponentPool.
+		explicit TagPool(const ChangeTick*) {}
+
+		/*
+		 *  emplace(): Tag entity. ctorArgs are ignored - tags hold no data.
+		 *
+		 *  Returns:
+		 *    - Reference to shared C instance.
+		 */
+		template<typename... Args>
+		C& emplace(const EntityId id, Args&&...) {
+			const auto index = getEntityIndex(id);
+			const auto word = index / wordBits;
+
+			if (word >= _words.size())
+				_words.resize(word + 1, 0);
+
+			const auto bit = Word(1) << (index % wordBits);
+			if (!(_words[word] & bit))
+			{
+				_words[word] |= bit;
+				++_count;
+			}
+
+			return _instance;
+		}
+
+		void markChanged(const EntityId) {}
+
+		virtual bool contains(const EntityId id) const override {
+			const auto index = getEntityIndex(id);
+			const auto word = index / wordBits;
+
+			return (word < _words.size()) && (_words[word] & (Word(1) << (index % wordBits)));
+		}
+
+		/*
+		 *  get(): Return reference to shared C instance.
+		 *
+		 *  Throws:
+		 *    - NotFoundError if entity doesn't have the tag.
+		 */
+		C& get(const EntityId id) {
+			if (!contains(id))
+				throw Exceptions::NotFoundError("ECS::TagPool::get() failed: Entity doesn't have requested component.");
+
+			return _instance;
+		}
+
+		const C& get(const EntityId id) const {
+			return const_cast<TagPool&>(*this).get(id);
+		}
+
+		C& getInstance() {
+			return _instance;
+		}
+
+		virtual void remove(const EntityId id) override {
+			if (!contains(id))
+				return;
+
+			const auto index = getEntityIndex(id);
+			_words[index / wordBits] &= ~(Word(1) << (index % wordBits));
+			--_count;
+		}
+
+		virtual void clear() override {
+			_words.clear();
+			_count = 0;
+		}
+
+		virtual std::size_t size() const override {
+			return _count;
+		}
+
+		virtual MemoryUsage getMemoryUsage() const override {
+			MemoryUsage usage{ componentName<C>(), _count };
+			addVectorUsage(usage, _words);
+
+			return usage;
+		}
+
+		// Bitset grows with highest tagged index, not with count - nothing to reserve.
+		void reserve(const std::size_t) {}
+
+		/*
+		 *  getWords(): Return bitset words - bit (index % 64) of word (index / 64) is set if entity slot index has the tag.
+		 *  			Trailing words may be missing, they are all zeros.
+		 */
+		const std::vector<Word>& getWords() const {
+			return _words;
+		}
+
+	private:
+		std::vector<Word> _words;
+		std::size_t		  _count = 0;
+		C				  _instance;
+	};
+
+	/*
+	 *  forEachSetIndex(): Call func(index) for every set bit of word, where index is bit's position plus firstIndex.
+	 */
+	template<typename F>
+	void forEachSetIndex(std::uint64_t word, const std::size_t firstIndex, F&& func) {
+		while (word != 0)
+		{
+#if defined(__GNUC__) || defined(__clang__)
+			const auto bit = static_cast<std::size_t>(__builtin_ctzll(word));
+#else
+			std::size_t bit = 0;
+			while (!(word & (std::uint64_t(1) << bit)))
+				++bit;
+#endif
+			func(firstIndex + bit);
+			word &= word - 1;
+		}
+	}
+
+	/*
+	 *  PoolFor: Pool type storing components of type C - TagPool for tags, ComponentPool otherwise.
+	 */
+	template<typename C>
+	using PoolFor = std::conditional_t<isTagComponent<C>, TagPool<C>, ComponentPool<C>>;
+}
@@ -0,0 +1,425 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "GameLibrary/ECS/EntityId.h"
+#include "GameLibrary/Exceptions/Standard.h"
+
+
+namespace GameLibrary::ECS
+{
+	/*
+	 *  ComposeTransforms: Default composition of TransformHierarchy - world transform of a child is parentWorld * local.
+	 */
+	struct ComposeTransforms {
+		template<typename T>
+		T operator() (const T& parentWorld, const T& local) const {
+			return parentWorld * local;
+		}
+	};
+
+	/*
+	 *  TransformHierarchy: Parent / child relations of entities, with local and world transforms of type T.
+	 *
+	 *  					Nodes are kept in depth-first order, in parallel arrays - every subtree is a contiguous range
+	 *  					starting at its root, so parents always precede their children. Propagating world transforms
+	 *  					is a linear walk over subtrees of nodes whose local transform changed, clean subtrees are not visited.
+	 *
+	 *  					Insertion is immediate (see insert() for its cost).
+	 *  					Reparenting and removal are queued, and applied by update() - a reparent moves its subtree's range
+	 *  					in place (rotation of arrays between old and new position), all removals are compacted in a single pass.
+	 *  					Compose(parentWorld, local) returns world transform of a child, see ComposeTransforms.
+	 *
+	 * * * * * * *
+	 *
+	 *  Example usage:
+	 *
+	 *    TransformHierarchy<Transform> hierarchy;
+	 *
+	 *    hierarchy.insert(ship, shipTransform);
+	 *    hierarchy.insert(turret, turretOffset, ship);
+	 *
+	 *    hierarchy.setLocal(ship, movedTransform);
+	 *    hierarchy.update(mgr);
+	 *    draw(hierarchy.getWorld(turret));
+	 *
+	 * * * * * * *
+	 */
+	template<typename T, typename Compose = ComposeTransforms>
+	class TransformHierarchy
+	{
+	public:
+		static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+		explicit TransformHierarchy(Compose compose = {}) : _compose(std::move(compose)) {}
+
+		/*
+		 *  insert(): Add entity with local transform, as last child of parent, or as a root if parent is null.
+		 *  		  Its world transform is computed by next update().
+		 *
+		 *  		  Inserted right away, not queued - arrays are shifted to open a slot at the end of parent's subtree,
+		 *  		  so insertion costs O(nodes after that slot + depth). Roots, and children of the last subtree, are appended
+		 *  		  at O(depth): build hierarchies depth-first (each node right after its parent's earlier descendants),
+		 *  		  as inserting N children into an early subtree one by one is O(N^2).
+		 *
+		 *  Throws:
+		 *    - InvalidArgument if entity's slot is already in hierarchy (under this, or a stale handle - remove stale ones first).
+		 *    - NotFoundError if parent isn't null, and isn't in hierarchy.
+		 */
+		void insert(const EntityId id, const T& local, const EntityId parent = EntityId()) {
+			const auto index = getEntityIndex(id);
+			if (index < _sparse.size() && _sparse[index] != npos)
+				throw Exceptions::InvalidArgument("ECS::TransformHierarchy::insert() failed: Entity is already in hierarchy.");
+
+			const auto position = parent.isNull() ? size() : endOfSubtree(getPosition(parent, "insert"));
+
+			_entities.insert(std::begin(_entities) + position, id);
+			_parents.insert(std::begin(_parents) + position, parent);
+			_subtreeSizes.insert(std::begin(_subtreeSizes) + position, 1);
+			_locals.insert(std::begin(_locals) + position, local);
+			_worlds.insert(std::begin(_worlds) + position, local);
+
+			if (index >= _sparse.size())
+				_sparse.resize(index + 1, npos);
+
+			reindex(position, size());
+			resizeAncestors(parent, 1);
+			_dirty.emplace_back(id);
+		}
+
+		/*
+		 *  setParent(): Queue moving entity (with its subtree) under parent, as its last child. Null parent makes entity a root.
+		 *  			 Applied by update(), in order of calls - moves which became invalid by then (e.g. entity was removed) are skipped.
+		 *
+		 *  Throws:
+		 *    - NotFoundError if entity or non-null parent isn't in hierarchy.
+		 *    - InvalidArgument if parent is entity itself, or its descendant.
+		 */
+		void setParent(const EntityId id, const EntityId parent) {
+			const auto position = getPosition(id, "setParent");
+
+			if (!parent.isNull())
+			{
+				const auto parentPosition = getPosition(parent, "setParent");
+				if (parentPosition >= position && parentPosition < endOfSubtree(position))
+					throw Exceptions::InvalidArgument("ECS::TransformHierarchy::setParent() failed: Entity can't be its own ancestor.");
+			}
+
+			_pendingMoves.emplace_back(id, parent);
+		}
+
+		/*
+		 *  remove(): Queue removal of entity and all its descendants. Has no effect if entity isn't in hierarchy at update().
+		 */
+		void remove(const EntityId id) {
+			_pendingRemovals.emplace_back(id);
+		}
+
+		void remove(const std::vector<EntityId>& ids) {
+			_pendingRemovals.insert(std::end(_pendingRemovals), std::cbegin(ids), std::cend(ids));
+		}
+
+		/*
+		 *  setLocal(): Replace entity's local transform. World transforms of its subtree are recomputed by next update().
+		 *
+		 *  Throws:
+		 *    - NotFoundError if entity isn't in hierarchy.
+		 */
+		void setLocal(const EntityId id, const T& local) {
+			_locals[getPosition(id, "setLocal")] = local;
+			_dirty.emplace_back(id);
+		}
+
+		/*
+		 *  getLocal(): Return entity's local transform.
+		 *
+		 *  Throws:
+		 *    - NotFoundError if entity isn't in hierarchy.
+		 */
+		const T& getLocal(const EntityId id) const {
+			return _locals[getPosition(id, "getLocal")];
+		}
+
+		/*
+		 *  getWorld(): Return entity's world transform, as of last update().
+		 *
+		 *  Throws:
+		 *    - NotFoundError if entity isn't in hierarchy.
+		 */
+		const T& getWorld(const EntityId id) const {
+			return _worlds[getPosition(id, "getWorld")];
+		}
+
+		/*
+		 *  getParent(): Return entity's parent, or null handle for roots.
+		 *
+		 *  Throws:
+		 *    - NotFoundError if entity isn't in hierarchy.
+		 */
+		EntityId getParent(const EntityId id) const {
+			return _parents[getPosition(id, "getParent")];
+		}
+
+		/*
+		 *  getSubtreeSize(): Return count of entity's descendants, plus one for entity itself.
+		 *
+		 *  Throws:
+		 *    - NotFoundError if entity isn't in hierarchy.
+		 */
+		std::size_t getSubtreeSize(const EntityId id) const {
+			return _subtreeSizes[getPosition(id, "getSubtreeSize")];
+		}
+
+		bool contains(const EntityId id) const {
+			return find(id) != npos;
+		}
+
+		/*
+		 *  update(): Apply queued removals and reparents, then recompute world transforms of subtrees whose root changed.
+		 */
+		void update() {
+			applyRemovals([ ] ( EntityId ) {});
+			applyMoves();
+			propagate();
+		}
+
+		/*
+		 *  update(): Same as update(), additionally removing entities of removed subtrees from mgr.
+		 */
+		template<typename Manager>
+		void update(Manager& mgr) {
+			applyRemovals([ &mgr ] ( const EntityId id ) { mgr.removeEntity(id); });
+			applyMoves();
+			propagate();
+		}
+
+		std::size_t size() const {
+			return _entities.size();
+		}
+
+		/*
+		 *  getEntities(): Return entities in depth-first order - world transform of i-th entity is getWorlds()[i].
+		 */
+		const std::vector<EntityId>& getEntities() const {
+			return _entities;
+		}
+
+		const std::vector<T>& getWorlds() const {
+			return _worlds;
+		}
+
+		void clear() {
+			_entities.clear();
+			_parents.clear();
+			_subtreeSizes.clear();
+			_locals.clear();
+			_worlds.clear();
+			_sparse.clear();
+			_dirty.clear();
+			_pendingMoves.clear();
+			_pendingRemovals.clear();
+		}
+
+	private:
+		std::size_t find(const EntityId id) const {
+			const auto index = getEntityIndex(id);
+
+			if (id.isNull() || index >= _sparse.size())
+				return npos;
+
+			const auto position = _sparse[index];
+
+			return (position != npos && _entities[position] == id) ? position : npos;
+		}
+
+		std::size_t getPosition(const EntityId id, const char* method) const {
+			const auto position = find(id);
+			if (position == npos)
+				throw Exceptions::NotFoundError(std::string("ECS::TransformHierarchy::") + method + "() failed: Entity isn't in hierarchy.");
+
+			return position;
+		}
+
+		std::size_t endOfSubtree(const std::size_t position) const {
+			return position + _subtreeSizes[position];
+		}
+
+		// Point sparse entries of entities at positions [first, last) to their positions.
+		void reindex(const std::size_t first, const std::size_t last) {
+			for (auto position = first; position < last; ++position)
+				_sparse[getEntityIndex(_entities[position])] = position;
+		}
+
+		// Add delta to subtree sizes of parent and all its ancestors.
+		void resizeAncestors(EntityId parent, const std::ptrdiff_t delta) {
+			while (!parent.isNull())
+			{
+				const auto position = find(parent);
+				_subtreeSizes[position] = static_cast<std::size_t>(static_cast<std::ptrdiff_t>(_subtreeSizes[position]) + delta);
+				parent = _parents[position];
+			}
+		}
+
+		template<typename F>
+		void applyRemovals(F&& onRemoved) {
+			if (_pendingRemovals.empty())
+				return;
+
+			std::vector<std::size_t> positions;
+			positions.reserve(_pendingRemovals.size());
+			for (const auto id : _pendingRemovals)
+			{
+				const auto position = find(id);
+				if (position != npos)
+					positions.emplace_back(position);
+			}
+			_pendingRemovals.clear();
+
+			// Ancestors come first, so subtrees nested in already removed ones are skipped.
+			std::sort(std::begin(positions), std::end(positions));
+
+			std::vector<bool> isRemoved(size(), false);
+			for (const auto position : positions)
+			{
+				if (isRemoved[position])
+					continue;
+
+				const auto end = endOfSubtree(position);
+				std::fill(std::begin(isRemoved) + position, std::begin(isRemoved) + end, true);
+				resizeAncestors(_parents[position], -static_cast<std::ptrdiff_t>(end - position));
+			}
+
+			// Compact all arrays at once, keeping depth-first order.
+			std::size_t kept = 0;
+			for (std::size_t position = 0; position < size(); ++position)
+			{
+				const auto id = _entities[position];
+
+				if (isRemoved[position])
+				{
+					_sparse[getEntityIndex(id)] = npos;
+					onRemoved(id);
+					continue;
+				}
+
+				if (kept != position)
+				{
+					_entities[kept] = id;
+					_parents[kept] = _parents[position];
+					_subtreeSizes[kept] = _subtreeSizes[position];
+					_locals[kept] = std::move(_locals[position]);
+					_worlds[kept] = std::move(_worlds[position]);
+					_sparse[getEntityIndex(id)] = kept;
+				}
+				++kept;
+			}
+
+			_entities.resize(kept);
+			_parents.resize(kept);
+			_subtreeSizes.resize(kept);
+			_locals.erase(std::begin(_locals) + kept, std::end(_locals));
+			_worlds.erase(std::begin(_worlds) + kept, std::end(_worlds));
+		}
+
+		void applyMoves() {
+			for (const auto& [id, parent] : _pendingMoves)
+				move(id, parent);
+
+			_pendingMoves.clear();
+		}
+
+		void move(const EntityId id, const EntityId parent) {
+			const auto first = find(id);
+			if (first == npos || (!parent.isNull() && find(parent) == npos))
+				return;
+
+			const auto end = endOfSubtree(first);
+			const auto parentPosition = find(parent);
+			if (parentPosition != npos && parentPosition >= first && parentPosition < end)
+				return;
+
+			// Subtree goes right after new parent's subtree (which may hold it now), or to the end for roots.
+			const auto target = (parentPosition == npos) ? size() : endOfSubtree(parentPosition);
+			const auto length = static_cast<std::ptrdiff_t>(end - first);
+			resizeAncestors(_parents[first], -length);
+
+			if (target > end)
+			{
+				rotate(first, end, target);
+				reindex(first, target);
+			}
+			else if (target < first)
+			{
+				rotate(target, first, end);
+				reindex(target, end);
+			}
+
+			_parents[find(id)] = parent;
+			resizeAncestors(parent, length);
+			_dirty.emplace_back(id);
+		}
+
+		// Rotate range [first, last) of all arrays, so element at middle becomes first.
+		void rotate(const std::size_t first, const std::size_t middle, const std::size_t last) {
+			const auto rotateArray = [ first, middle, last ] ( auto& array ) {
+				std::rotate(std::begin(array) + first, std::begin(array) + middle, std::begin(array) + last);
+			};
+
+			rotateArray(_entities);
+			rotateArray(_parents);
+			rotateArray(_subtreeSizes);
+			rotateArray(_locals);
+			rotateArray(_worlds);
+		}
+
+		void propagate() {
+			std::vector<std::size_t> roots;
+			roots.reserve(_dirty.size());
+			for (const auto id : _dirty)
+			{
+				const auto position = find(id);
+				if (position != npos)
+					roots.emplace_back(position);
+			}
+			_dirty.clear();
+
+			// Parents precede children, so every subtree is walked after its ancestors are up to date.
+			std::sort(std::begin(roots), std::end(roots));
+
+			std::size_t updatedEnd = 0;
+			for (const auto root : roots)
+			{
+				if (root < updatedEnd)
+					continue;
+
+				updatedEnd = endOfSubtree(root);
+				for (auto position = root; position < updatedEnd; ++position)
+				{
+					const auto parent = _parents[position];
+					_worlds[position] = parent.isNull() ? _locals[position] : _compose(_worlds[_sparse[getEntityIndex(parent)]], _locals[position]);
+				}
+			}
+		}
+
+		Compose										_compose;
+
+		// Parallel arrays, in depth-first order.
+		std::vector<EntityId>						_entities;
+		std::vector<EntityId>						_parents;
+		std::vector<std::size_t>					_subtreeSizes;
+		std::vector<T>								_locals;
+		std::vector<T>								_worlds;
+
+		// Entity index -> position, or npos.
+		std::vector<std::size_t>					_sparse;
+
+		// Entities whose subtree needs world transforms recomputed.
+		std::vector<EntityId>						_dirty;
+		std::vector<std::pair<EntityId, EntityId>>	_pendingMoves;
+		std::vector<EntityId>						_pendingRemovals;
+	};
+}
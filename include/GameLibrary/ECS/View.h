@@ -0,0 +1,282 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#include "GameLibrary/ECS/EntityId.h"
+#include "GameLibrary/ECS/Exclude.h"
+#include "GameLibrary/ECS/Storage/ComponentPool.h"
+#include "GameLibrary/ECS/Storage/TagPool.h"
+#include "GameLibrary/Utilities/ThreadPool.h"
+
+
+namespace GameLibrary::ECS
+{
+	template<typename Excludes, typename... Cs>
+	class View;
+
+	/*
+	 *  View: Iterable set of entities having all of Cs... components, and none of Excluded... components.
+	 *
+	 *  	  Iteration is driven by the smallest of Cs... pools, remaining pools are only probed by entity index.
+	 *  	  Components are yielded as C& - no casts involved. Adding / removing components of viewed types invalidates iterators.
+	 *  	  Tag components (see TagPool) are checked by a single bit test, and can't drive iteration - at least one of Cs... must not be a tag.
+	 *
+	 * * * * * * *
+	 *
+	 *  Example usage:
+	 *
+	 *    mgr.view<Position, Velocity>(exclude<Dead>).forEach([ ] ( Position& p, const Velocity& v ) { p.x += v.dx; });
+	 *
+	 *    for (auto [id, position, velocity] : mgr.view<Position, Velocity>())
+	 *        ...
+	 *
+	 * * * * * * *
+	 */
+	template<typename... Excluded, typename... Cs>
+	class View<Exclude<Excluded...>, Cs...>
+	{
+		static_assert(sizeof...(Cs) > 0, "ECS::View: At least one component type is required.");
+		static_assert(!(isTagComponent<Cs> && ...), "ECS::View: At least one component type must not be a tag - use EntityManager::forEachTagged() for tags only.");
+
+		using Entities = std::vector<EntityId>;
+	public:
+		using Value = std::tuple<EntityId, Cs&...>;
+
+		class Iterator
+		{
+		public:
+			using iterator_category = std::forward_iterator_tag;
+			using value_type = Value;
+			using difference_type = std::ptrdiff_t;
+			using pointer = void;
+			using reference = Value;
+
+			Iterator(const View& view, const EntityId* current, const EntityId* end) : _view(&view), _current(current), _end(end) {
+				skipNotContained();
+			}
+
+			Value operator* () const {
+				return Value(*_current, _view->template getUnchecked<Cs>(*_current)...);
+			}
+
+			Iterator& operator++ () {
+				++_current;
+				skipNotContained();
+
+				return *this;
+			}
+
+			Iterator operator++ (int) {
+				auto previous = *this;
+				++(*this);
+
+				return previous;
+			}
+
+			bool operator== (const Iterator& other) const {
+				return _current == other._current;
+			}
+
+			bool operator!= (const Iterator& other) const {
+				return _current != other._current;
+			}
+
+		private:
+			void skipNotContained() {
+				while (_current != _end && !_view->contains(*_current))
+					++_current;
+			}
+
+			const View*		_view;
+			const EntityId* _current;
+			const EntityId* _end;
+		};
+
+		template<typename C>
+		class ChangeFilter;
+
+		/*
+		 *  View(): Construct view over supplied pools. Excluded pools may be nullptr (nothing to exclude).
+		 */
+		View(PoolFor<Cs>&... pools, const PoolFor<Excluded>*... excludedPools)
+				: _pools(&pools...), _excludedPools(excludedPools...), _driver(&smallestPoolEntities()) {}
+
+		/*
+		 *  contains(): Check if entity has all of Cs... components and none of Excluded... components.
+		 */
+		bool contains(const EntityId id) const {
+			return (std::get<PoolFor<Cs>*>(_pools)->contains(id) && ...)
+				&& !(isExcludedBy(std::get<const PoolFor<Excluded>*>(_excludedPools), id) || ...);
+		}
+
+		/*
+		 *  get(): Return reference to entity's component of type C. Entity must be contained in the View.
+		 */
+		template<typename C>
+		C& get(const EntityId id) const {
+			return getUnchecked<C>(id);
+		}
+
+		/*
+		 *  forEach(): Call func for every entity in the View.
+		 *  		   func may take (EntityId, Cs&...) or just (Cs&...).
+		 *  		   func must not add or remove components of viewed types.
+		 */
+		template<typename F>
+		void forEach(F&& func) const {
+			for (const auto id : *_driver)
+			{
+				if (contains(id))
+					invoke(func, id);
+			}
+		}
+
+		/*
+		 *  parallelForEach(): Call func for every entity in the View, splitting driving pool into ranges executed on threadPool.
+		 *  				   Takes same callbacks as forEach(). Returns after all entities are visited.
+		 *
+		 *  				   func is called concurrently, so it may only modify components of the entity it was called for.
+		 *  				   func must not add or remove components / entities.
+		 *
+		 *  Throws:
+		 *    - First exception thrown by func.
+		 */
+		template<typename F>
+		void parallelForEach(Utilities::ThreadPool& threadPool, F&& func, const Utilities::ParallelForOptions options = {}) const {
+			const auto& candidates = *_driver;
+
+			threadPool.parallelFor(candidates.size(), [ this, &candidates, &func ] ( const std::size_t begin, const std::size_t end ) {
+				for (auto i = begin; i < end; ++i)
+				{
+					if (contains(candidates[i]))
+						invoke(func, candidates[i]);
+				}
+			}, options);
+		}
+
+		/*
+		 *  changed(): Return filter of the View visiting only entities whose C component was added or changed after tick since.
+		 *  		   Cost is proportional to count of changes, not size of the View.
+		 *
+		 *  		   Example: mgr.view<Position, Collider>().changed<Position>(since).forEach(...);
+		 */
+		template<typename C>
+		ChangeFilter<C> changed(const ChangeTick since) const {
+			return ChangeFilter<C>(*this, since, false);
+		}
+
+		/*
+		 *  added(): Return filter of the View visiting only entities whose C component was added after tick since.
+		 */
+		template<typename C>
+		ChangeFilter<C> added(const ChangeTick since) const {
+			return ChangeFilter<C>(*this, since, true);
+		}
+
+		/*
+		 *  sizeHint(): Return upper bound of entity count in View (size of driving pool).
+		 */
+		std::size_t sizeHint() const {
+			return _driver->size();
+		}
+
+		/*
+		 *  getCandidates(): Return entities of driving pool - superset of entities in View.
+		 */
+		const Entities& getCandidates() const {
+			return *_driver;
+		}
+
+		Iterator begin() const {
+			return Iterator(*this, _driver->data(), _driver->data() + _driver->size());
+		}
+
+		Iterator end() const {
+			const auto* last = _driver->data() + _driver->size();
+			return Iterator(*this, last, last);
+		}
+
+	private:
+		template<typename F>
+		void invoke(F& func, const EntityId id) const {
+			if constexpr (std::is_invocable_v<F&, EntityId, Cs&...>)
+				func(id, getUnchecked<Cs>(id)...);
+			else
+				func(getUnchecked<Cs>(id)...);
+		}
+
+		template<typename C>
+		C& getUnchecked(const EntityId id) const {
+			auto* pool = std::get<PoolFor<C>*>(_pools);
+
+			if constexpr (isTagComponent<C>)
+				return pool->getInstance();
+			else
+				return pool->getComponents()[pool->find(id)];
+		}
+
+		template<typename P>
+		static bool isExcludedBy(const P* pool, const EntityId id) {
+			return pool && pool->contains(id);
+		}
+
+		const Entities& smallestPoolEntities() const {
+			const Entities* smallest = nullptr;
+
+			const auto pickIfSmaller = [ &smallest ] ( const auto* pool ) {
+				if constexpr (!isTagComponent<typename std::decay_t<decltype(*pool)>::Component>)
+				{
+					if (!smallest || pool->getEntities().size() < smallest->size())
+						smallest = &pool->getEntities();
+				}
+			};
+			(pickIfSmaller(std::get<PoolFor<Cs>*>(_pools)), ...);
+
+			return *smallest;
+		}
+
+		std::tuple<PoolFor<Cs>*...>					_pools;
+		std::tuple<const PoolFor<Excluded>*...>		_excludedPools;
+		const Entities*									_driver;
+	};
+
+	/*
+	 *  View::ChangeFilter: View restricted to entities whose C component was added / changed after a tick. See changed() and added().
+	 */
+	template<typename... Excluded, typename... Cs>
+	template<typename C>
+	class View<Exclude<Excluded...>, Cs...>::ChangeFilter
+	{
+	public:
+		ChangeFilter(const View& view, const ChangeTick since, const bool addedOnly) : _view(view), _since(since), _addedOnly(addedOnly) {}
+
+		/*
+		 *  forEach(): Call func for every entity of the View passing the filter, in order of changes.
+		 *  		   Takes same callbacks as View::forEach().
+		 */
+		template<typename F>
+		void forEach(F&& func) const {
+			const auto visit = [ this, &func ] ( const EntityId id ) {
+				if (_view.contains(id))
+					_view.invoke(func, id);
+			};
+			const auto* pool = std::get<ComponentPool<C>*>(_view._pools);
+
+			if (_addedOnly)
+				pool->forEachAdded(_since, visit);
+			else
+				pool->forEachChanged(_since, visit);
+		}
+
+	private:
+		// Held by value - View only holds pool pointers, and filter may outlive the temporary it was made from.
+		View		_view;
+		ChangeTick	_since;
+		bool		_addedOnly;
+	};
+}
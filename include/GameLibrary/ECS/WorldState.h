@@ -0,0 +1,201 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#include <boost/mp11.hpp>
+
+#include "GameLibrary/ECS/Component.h"
+#include "GameLibrary/ECS/ComponentMask.h"
+#include "GameLibrary/ECS/EntityId.h"
+#include "GameLibrary/ECS/EntityManager.h"
+#include "GameLibrary/ECS/EntityTable.h"
+#include "GameLibrary/ECS/Storage/TagPool.h"
+#include "GameLibrary/Exceptions/Standard.h"
+
+
+namespace GameLibrary::ECS
+{
+	/*
+	 *  WorldState: In-memory copy of an EntityManager's entities and its components of types Components... -
+	 *  			meant to be captured and restored many times per second (rollback, instant replays).
+	 *
+	 *  			Components are copied column by column (entities, then components of a type), as whole arrays.
+	 *  			Buffers are kept between captures, so capturing a world of similar size doesn't allocate.
+	 *  			Restored handles are exactly the captured ones - stale handles stay stale, freed slots are reused in the same order.
+	 *
+	 * * * * * * *
+	 *
+	 *  Example usage:
+	 *
+	 *    WorldState<Position, Velocity, Enemy> state;
+	 *
+	 *    state.capture(mgr);
+	 *    ...
+	 *    state.restore(mgr);
+	 *
+	 * * * * * * *
+	 */
+	template<typename... Components>
+	class WorldState
+	{
+		static_assert(boost::mp11::mp_is_set<boost::mp11::mp_list<Components...>>::value, "ECS::WorldState: Component types must be unique.");
+		static_assert((std::is_trivially_copyable_v<Components> && ...), "ECS::WorldState: Components must be trivially copyable.");
+	public:
+		/*
+		 *  capture(): Replace held state with current state of mgr. Components of other types are not captured.
+		 */
+		void capture(const EntityManager& mgr) {
+			_entities = mgr._entities;
+			(captureColumn<Components>(mgr), ...);
+			_isCaptured = true;
+		}
+
+		/*
+		 *  restore(): Replace entities and components of mgr with held state. Components of types other than Components... are removed.
+		 *  		   Restored components are stamped as added at mgr's current tick, so change-driven systems pick them up.
+		 *  		   Observers are not notified.
+		 *
+		 *  Throws:
+		 *    - NotFoundError if no state was captured.
+		 */
+		void restore(EntityManager& mgr) const {
+			if (!_isCaptured)
+				throw Exceptions::NotFoundError("ECS::WorldState::restore() failed: No state was captured.");
+
+			mgr._storage.clear();
+			mgr._entities = _entities;
+			mgr._signatures.assign(_entities.getCapacity(), ComponentMask());
+
+			(restoreColumn<Components>(mgr), ...);
+		}
+
+		bool isCaptured() const {
+			return _isCaptured;
+		}
+
+		/*
+		 *  getEntityCount(): Return count of live entities in held state.
+		 */
+		std::size_t getEntityCount() const {
+			return _entities.getAliveCount();
+		}
+
+	private:
+		template<typename C>
+		struct Column {
+			std::vector<EntityId> entities;
+			// Empty for tags.
+			std::vector<C>		  components;
+		};
+
+		template<typename C>
+		void captureColumn(const EntityManager& mgr) {
+			auto& column = std::get<Column<C>>(_columns);
+			const auto* pool = mgr._storage.template findPool<C>();
+
+			column.entities.clear();
+			column.components.clear();
+			if (!pool)
+				return;
+
+			if constexpr (isTagComponent<C>)
+			{
+				// Tags are kept per slot - collect handles of tagged slots.
+				const auto& words = pool->getWords();
+				for (std::size_t word = 0; word < words.size(); ++word)
+				{
+					forEachSetIndex(words[word], word * TagPool<C>::wordBits, [ &mgr, &column ] ( const std::size_t index ) {
+						column.entities.emplace_back(mgr._entities.getHandle(static_cast<EntityId::Index>(index)));
+					});
+				}
+			}
+			else
+			{
+				column.entities.assign(std::cbegin(pool->getEntities()), std::cend(pool->getEntities()));
+				column.components.assign(std::cbegin(pool->getComponents()), std::cend(pool->getComponents()));
+			}
+		}
+
+		template<typename C>
+		void restoreColumn(EntityManager& mgr) const {
+			const auto& column = std::get<Column<C>>(_columns);
+			const auto index = componentIndex<C>();
+
+			for (const auto id : column.entities)
+				mgr._signatures[id.getIndex()].set(index);
+
+			mgr._storage.template assign<C>(column.entities.data(), column.components.data(), column.entities.size());
+		}
+
+		EntityTable						  _entities;
+		std::tuple<Column<Components>...> _columns;
+		bool							  _isCaptured = false;
+	};
+
+	/*
+	 *  WorldStateHistory: Ring buffer of WorldStates of the last capacity frames, for rolling back to any of them.
+	 *
+	 *  				   Capturing a frame overwrites the oldest one, reusing its buffers - steady-state capturing doesn't allocate.
+	 *
+	 *  				   Example: history.capture(mgr, frame); ... history.restore(mgr, confirmedFrame);
+	 */
+	template<typename... Components>
+	class WorldStateHistory
+	{
+	public:
+		using Frame = std::uint64_t;
+
+		/*
+		 *  WorldStateHistory(): Construct history of capacity frames.
+		 *
+		 *  Throws:
+		 *    - InvalidArgument if capacity is 0.
+		 */
+		explicit WorldStateHistory(const std::size_t capacity) : _states(capacity), _frames(capacity, noFrame) {
+			if (capacity == 0)
+				throw Exceptions::InvalidArgument("ECS::WorldStateHistory::WorldStateHistory() failed: Capacity must be positive.");
+		}
+
+		/*
+		 *  capture(): Capture state of mgr as frame, replacing frame capacity frames older (or any other frame occupying its slot).
+		 */
+		void capture(const EntityManager& mgr, const Frame frame) {
+			const auto slot = frame % _states.size();
+
+			_states[slot].capture(mgr);
+			_frames[slot] = frame;
+		}
+
+		/*
+		 *  restore(): Restore mgr to state captured as frame. Frame stays in the history.
+		 *
+		 *  Throws:
+		 *    - NotFoundError if frame isn't held (was never captured, or was overwritten).
+		 */
+		void restore(EntityManager& mgr, const Frame frame) const {
+			if (!contains(frame))
+				throw Exceptions::NotFoundError("ECS::WorldStateHistory::restore() failed: Frame isn't held.");
+
+			_states[frame % _states.size()].restore(mgr);
+		}
+
+		bool contains(const Frame frame) const {
+			return frame != noFrame && _frames[frame % _states.size()] == frame;
+		}
+
+		std::size_t getCapacity() const {
+			return _states.size();
+		}
+
+	private:
+		static constexpr Frame noFrame = static_cast<Frame>(-1);
+
+		std::vector<WorldState<Components...>> _states;
+		std::vector<Frame>					   _frames;
+	};
+}
@@ -9,10 +9,18 @@ namespace GameLibrary::Exceptions
 		using std::runtime_error::runtime_error;
 	};
 
+	class FormatError : public std::runtime_error {
+		using std::runtime_error::runtime_error;
+	};
+
 	class InvalidArgument : public std::invalid_argument {
 		using std::invalid_argument::invalid_argument;
 	};
 
+	class IoError : public std::runtime_error {
+		using std::runtime_error::runtime_error;
+	};
+
 	class NotFoundError : public std::runtime_error {
 		using std::runtime_error::runtime_error;
 	};
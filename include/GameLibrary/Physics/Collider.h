@@ -0,0 +1,73 @@
+#pragma once
+
+#include <algorithm>
+#include <vector>
+
+#include "GameLibrary/ECS/EntityId.h"
+
+
+namespace GameLibrary::Physics
+{
+	/*
+	 *  Aabb: Axis-aligned bounding box, bounds inclusive.
+	 */
+	struct Aabb {
+		float minX = 0.0f;
+		float minY = 0.0f;
+		float maxX = 0.0f;
+		float maxY = 0.0f;
+
+		bool overlaps(const Aabb& other) const {
+			return minX <= other.maxX && other.minX <= maxX && minY <= other.maxY && other.minY <= maxY;
+		}
+
+		bool contains(const Aabb& other) const {
+			return minX <= other.minX && minY <= other.minY && other.maxX <= maxX && other.maxY <= maxY;
+		}
+
+		float getPerimeter() const {
+			return 2.0f * ((maxX - minX) + (maxY - minY));
+		}
+
+		Aabb fattened(const float margin) const {
+			return { minX - margin, minY - margin, maxX + margin, maxY + margin };
+		}
+
+		static Aabb merge(const Aabb& first, const Aabb& second) {
+			return { std::min(first.minX, second.minX), std::min(first.minY, second.minY),
+					 std::max(first.maxX, second.maxX), std::max(first.maxY, second.maxY) };
+		}
+	};
+
+	/*
+	 *  Collider: Component holding entity's world-space bounds, used by broadphases (SweepAndPrune, DynamicAabbTree).
+	 *  		  Static colliders never collide with each other - only pairs with at least one dynamic collider are reported.
+	 */
+	struct Collider {
+		Aabb bounds;
+		bool isStatic = false;
+	};
+
+	/*
+	 *  OverlapPair: Two entities whose colliders overlap, first < second.
+	 */
+	struct OverlapPair {
+		ECS::EntityId first;
+		ECS::EntityId second;
+
+		bool operator== (const OverlapPair& other) const {
+			return first == other.first && second == other.second;
+		}
+
+		bool operator< (const OverlapPair& other) const {
+			return (first < other.first) || (first == other.first && second < other.second);
+		}
+	};
+
+	// Contiguous buffer of pairs, filled by broadphases. Reused across frames to keep its capacity.
+	using PairBuffer = std::vector<OverlapPair>;
+
+	inline OverlapPair makeOverlapPair(const ECS::EntityId first, const ECS::EntityId second) {
+		return (first < second) ? OverlapPair{ first, second } : OverlapPair{ second, first };
+	}
+}
@@ -0,0 +1,225 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "GameLibrary/ECS/EntityId.h"
+#include "GameLibrary/ECS/Storage/ComponentPool.h"
+#include "GameLibrary/Physics/Collider.h"
+
+
+namespace GameLibrary::Physics
+{
+	/*
+	 *  DynamicAabbTree: Broadphase keeping boxes in balanced binary trees of nested bounding boxes.
+	 *
+	 *  				 Leaves hold boxes enlarged by margin ("fat" boxes), so small movements don't restructure the trees.
+	 *  				 Static and dynamic boxes are kept in separate trees - static boxes cost nothing per frame once inserted,
+	 *  				 unless touched by dynamic ones. Suited for mixed static / dynamic worlds, where SweepAndPrune would
+	 *  				 re-sort static boxes every frame.
+	 *
+	 *  				 Tree is updated incrementally from Collider change ticks (see update()),
+	 *  				 removed colliders are passed to remove(), e.g. from ComponentsRemovedEvent<Collider>.
+	 *
+	 * * * * * * *
+	 *
+	 *  Example usage:
+	 *
+	 *    DynamicAabbTree tree;
+	 *    PairBuffer pairs;
+	 *
+	 *    const auto since = _lastUpdate;
+	 *    _lastUpdate = mgr.advanceChangeTick();
+	 *    tree.update(mgr, since);
+	 *    tree.findPairs(pairs);
+	 *
+	 * * * * * * *
+	 */
+	class DynamicAabbTree
+	{
+	public:
+		using ProxyId = std::int32_t;
+		static constexpr ProxyId nullProxy = -1;
+
+		/*
+		 *  DynamicAabbTree(): Construct empty tree, enlarging boxes by margin on every side.
+		 *
+		 *  Throws:
+		 *    - InvalidArgument if margin is negative.
+		 */
+		explicit DynamicAabbTree(float margin = 0.1f);
+
+		/*
+		 *  createProxy(): Insert box of entity into the tree.
+		 *
+		 *  Returns:
+		 *    - Proxy id, valid until destroyProxy().
+		 */
+		ProxyId createProxy(const Aabb& bounds, ECS::EntityId id, bool isStatic = false);
+
+		void destroyProxy(ProxyId proxy);
+
+		/*
+		 *  moveProxy(): Set new bounds of proxy. Tree is only restructured if bounds leave proxy's fat box.
+		 *
+		 *  Returns:
+		 *    - true if proxy was reinserted.
+		 */
+		bool moveProxy(ProxyId proxy, const Aabb& bounds);
+
+		void setStatic(ProxyId proxy, bool isStatic);
+
+		const Aabb& getBounds(const ProxyId proxy) const {
+			return _leaves[proxy].bounds;
+		}
+
+		const Aabb& getFatBounds(const ProxyId proxy) const {
+			return _nodes[proxy].fatBounds;
+		}
+
+		ECS::EntityId getEntity(const ProxyId proxy) const {
+			return _leaves[proxy].id;
+		}
+
+		/*
+		 *  query(): Call func(proxy) for every proxy whose fat box overlaps bounds. func must not modify the tree.
+		 */
+		template<typename F>
+		void query(const Aabb& bounds, F&& func) const {
+			std::vector<ProxyId> stack;
+			stack.reserve(64);
+
+			queryWithStack(_dynamicRoot, bounds, stack, func);
+			queryWithStack(_staticRoot, bounds, stack, func);
+		}
+
+		/*
+		 *  findPairs(): Replace content of pairs with all pairs of proxies whose (not fat) boxes overlap, except pairs of two static proxies.
+		 *  			 Static proxies which don't touch dynamic ones cost next to nothing.
+		 */
+		void findPairs(PairBuffer& pairs) const;
+
+		/*
+		 *  set(): Create proxy for entity, or move its existing proxy. Proxy of a stale handle with the same index is replaced.
+		 */
+		void set(ECS::EntityId id, const Aabb& bounds, bool isStatic = false);
+
+		/*
+		 *  remove(): Destroy proxy of entity. Has no effect if entity (with this generation) has no proxy.
+		 */
+		void remove(ECS::EntityId id);
+
+		void remove(const std::vector<ECS::EntityId>& ids) {
+			for (const auto id : ids)
+				remove(id);
+		}
+
+		bool contains(ECS::EntityId id) const;
+
+		/*
+		 *  update(): Create or move proxies of entities whose Collider component was added or changed after tick since.
+		 *  		  Manager must support change ticks (EntityManager, StaticWorld).
+		 */
+		template<typename Manager>
+		void update(Manager& mgr, const ECS::ChangeTick since) {
+			mgr.template view<Collider>().template changed<Collider>(since).forEach([ this ] ( const ECS::EntityId id, const Collider& collider ) {
+				set(id, collider.bounds, collider.isStatic);
+			});
+		}
+
+		std::size_t size() const {
+			return _proxyCount;
+		}
+
+		/*
+		 *  getHeight(): Return height of the taller of static and dynamic trees - 0 for a single leaf, -1 for empty trees.
+		 */
+		int getHeight() const {
+			const auto heightOf = [ this ] ( const ProxyId root ) { return (root == nullProxy) ? -1 : _nodes[root].height; };
+
+			return std::max(heightOf(_dynamicRoot), heightOf(_staticRoot));
+		}
+
+		void clear();
+
+	private:
+		// Only data needed to walk the tree, kept small so more nodes fit in cache.
+		struct Node {
+			bool isLeaf() const {
+				return left == nullProxy;
+			}
+
+			// Fat box for leaves, union of children's boxes for inner nodes.
+			Aabb	fatBounds;
+			// Next free node, for nodes in free list.
+			ProxyId parent = nullProxy;
+			ProxyId left = nullProxy;
+			ProxyId right = nullProxy;
+			// -1 for free nodes.
+			int		height = -1;
+		};
+
+		// Data of leaf nodes, at the same index as their Node.
+		struct Leaf {
+			Aabb		  bounds;
+			ECS::EntityId id;
+			bool		  isStatic = false;
+		};
+
+		template<typename F>
+		void queryWithStack(const ProxyId root, const Aabb& bounds, std::vector<ProxyId>& stack, F&& func) const {
+			if (root == nullProxy)
+				return;
+
+			stack.clear();
+			stack.push_back(root);
+
+			while (!stack.empty())
+			{
+				const auto index = stack.back();
+				stack.pop_back();
+
+				const auto& node = _nodes[index];
+				if (!node.fatBounds.overlaps(bounds))
+					continue;
+
+				if (node.isLeaf())
+					func(index);
+				else
+				{
+					stack.push_back(node.left);
+					stack.push_back(node.right);
+				}
+			}
+		}
+
+		ProxyId& rootOf(const ProxyId leaf) {
+			return _leaves[leaf].isStatic ? _staticRoot : _dynamicRoot;
+		}
+
+		ProxyId allocateNode();
+		void freeNode(ProxyId index);
+
+		void insertLeaf(ProxyId leaf);
+		void removeLeaf(ProxyId leaf);
+		// Refit boxes and heights from index up to the root, rotating unbalanced nodes.
+		void refitUpwards(ProxyId index);
+		ProxyId balance(ProxyId index);
+
+		float											 _margin;
+		std::vector<Node>								 _nodes;
+		std::vector<Leaf>								 _leaves;
+		ProxyId											 _dynamicRoot = nullProxy;
+		ProxyId											 _staticRoot = nullProxy;
+		ProxyId											 _freeList = nullProxy;
+		std::size_t										 _proxyCount = 0;
+
+		// Entity index -> proxy, or nullProxy.
+		std::vector<ProxyId>							 _proxies;
+		// Traversal stack of findPairs(), kept to reuse its capacity.
+		mutable std::vector<std::pair<ProxyId, ProxyId>> _stack;
+	};
+}
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "GameLibrary/ECS/EntityId.h"
+#include "GameLibrary/Physics/Collider.h"
+
+
+namespace GameLibrary::Physics
+{
+	/*
+	 *  SweepAndPrune: Broadphase sorting projections of boxes on one axis, and sweeping them in order -
+	 *  			   only boxes whose projections overlap are tested on the other axis.
+	 *
+	 *  			   Boxes are added anew every frame (see findPairs(mgr, pairs)), sweep axis is picked per frame
+	 *  			   as the one along which boxes are spread the most. Best suited for many similarly sized moving boxes.
+	 *
+	 *  			   Example: SweepAndPrune broadphase;
+	 *  						PairBuffer pairs;
+	 *  						broadphase.findPairs(mgr, pairs);
+	 */
+	class SweepAndPrune
+	{
+	public:
+		void add(const ECS::EntityId id, const Aabb& bounds, const bool isStatic = false) {
+			_boxes.push_back({ bounds, id, isStatic });
+		}
+
+		void clear() {
+			_boxes.clear();
+		}
+
+		std::size_t size() const {
+			return _boxes.size();
+		}
+
+		void reserve(const std::size_t count) {
+			_boxes.reserve(count);
+		}
+
+		/*
+		 *  findPairs(): Replace content of pairs with all overlapping pairs of added boxes, except pairs of two static boxes.
+		 */
+		void findPairs(PairBuffer& pairs);
+
+		/*
+		 *  findPairs(): Replace added boxes with Collider components of mgr's entities, and find their overlapping pairs.
+		 */
+		template<typename Manager>
+		void findPairs(Manager& mgr, PairBuffer& pairs) {
+			clear();
+			mgr.template forEach<Collider>([ this ] ( const ECS::EntityId id, const Collider& collider ) {
+				add(id, collider.bounds, collider.isStatic);
+			});
+
+			findPairs(pairs);
+		}
+
+	private:
+		struct Box {
+			Aabb		  bounds;
+			ECS::EntityId id;
+			bool		  isStatic;
+		};
+
+		// Box projected on sweep axis (min, max) and the other axis (otherMin, otherMax), sorted by min.
+		struct Projection {
+			float		  min;
+			float		  max;
+			float		  otherMin;
+			float		  otherMax;
+			ECS::EntityId id;
+			bool		  isStatic;
+		};
+
+		std::vector<Box>		_boxes;
+		std::vector<Projection> _projections;
+	};
+}
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstddef>
 #include <limits>
 #include <set>
 #include <stack>
@@ -46,6 +47,17 @@ namespace GameLibrary::Utilities
 			}
 		}
 
+		std::size_t getUsedCount() const {
+			return _usedIds.size();
+		}
+
+		/*
+		 *  getFreeCount(): Return count of freed ids waiting to be reused.
+		 */
+		std::size_t getFreeCount() const {
+			return _freedIds.size();
+		}
+
 	private:
 		bool freeIdAvailable() const noexcept(noexcept(_freedIds.empty())) {
 			return !_freedIds.empty();
@@ -57,6 +69,7 @@ namespace GameLibrary::Utilities
 
 			const auto ret = _freedIds.top();
 			_freedIds.pop();
+			_usedIds.emplace(ret);
 			return ret;
 		}
 
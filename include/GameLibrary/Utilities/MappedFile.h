@@ -0,0 +1,47 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+
+namespace GameLibrary::Utilities
+{
+	/*
+	 *  MappedFile: Read-only view of a whole file's bytes.
+	 *
+	 *  			On POSIX systems file is memory-mapped, so pages are read by the OS on first access, without copying
+	 *  			through a user-space buffer. Elsewhere file is read into memory at once.
+	 *  			Data is aligned to at least 16 bytes.
+	 */
+	class MappedFile
+	{
+	public:
+		/*
+		 *  MappedFile(): Map file at path.
+		 *
+		 *  Throws:
+		 *    - IoError if file can't be opened or read.
+		 */
+		explicit MappedFile(const std::string& path);
+		~MappedFile();
+
+		MappedFile(const MappedFile&) = delete;
+		MappedFile& operator= (const MappedFile&) = delete;
+
+		const std::byte* data() const {
+			return _data;
+		}
+
+		std::size_t size() const {
+			return _size;
+		}
+
+	private:
+		const std::byte*	   _data = nullptr;
+		std::size_t			   _size = 0;
+		// Set when file is mapped, rather than read into _buffer.
+		bool				   _isMapped = false;
+		std::vector<std::byte> _buffer;
+	};
+}
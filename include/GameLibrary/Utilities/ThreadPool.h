@@ -0,0 +1,173 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+namespace GameLibrary::Utilities
+{
+	/*
+	 *  ParallelForOptions: Controls how ThreadPool::parallelFor() splits [0, count) into ranges.
+	 *
+	 *  					- grainSize: Size of a single range. 0 picks one from count and thread count.
+	 *  					- deterministic: Range boundaries depend only on count, grainSize and thread count,
+	 *  									 and range i is always executed by worker (i % threadCount) - no stealing.
+	 *  									 With grainSize 0, each worker gets exactly one contiguous range.
+	 */
+	struct ParallelForOptions {
+		std::size_t grainSize = 0;
+		bool deterministic = false;
+	};
+
+	/*
+	 *  ThreadPool: Fixed set of worker threads, each owning a task deque. Idle workers steal from others' deques.
+	 *
+	 *  			Owner takes newest tasks (back), thieves take oldest (front), so stolen work tends to be the largest remaining.
+	 *  			Threads waiting for their tasks (e.g. in parallelFor()) execute pending tasks instead of blocking,
+	 *  			so parallelFor() may be called from within tasks.
+	 */
+	class ThreadPool
+	{
+	public:
+		using Task = std::function<void()>;
+
+		/*
+		 *  ThreadPool(): Start threadCount workers.
+		 *
+		 *  Throws:
+		 *    - InvalidArgument if threadCount is 0.
+		 */
+		explicit ThreadPool(const std::size_t threadCount = getDefaultThreadCount());
+		~ThreadPool();
+
+		ThreadPool(const ThreadPool&) = delete;
+		ThreadPool& operator=(const ThreadPool&) = delete;
+
+		static std::size_t getDefaultThreadCount();
+
+		std::size_t getThreadCount() const;
+
+		/*
+		 *  submit(): Queue task for execution. Task is placed in calling worker's deque, or - if called from outside - distributed round-robin.
+		 */
+		void submit(Task task);
+
+		/*
+		 *  waitUntil(): Execute pending tasks on calling thread until isDone() returns true.
+		 *  			 Use to wait for tasks submitted with submit(), without blocking a worker.
+		 */
+		template<typename P>
+		void waitUntil(P&& isDone) {
+			while (!isDone())
+			{
+				if (!runPendingTask())
+					std::this_thread::yield();
+			}
+		}
+
+		/*
+		 *  parallelFor(): Split [0, count) into ranges, call func(begin, end) for each of them on the pool, and wait for all to finish.
+		 *  			   Calling thread helps with execution while waiting.
+		 *
+		 *  Throws:
+		 *    - First exception thrown by func, after all ranges have finished.
+		 */
+		template<typename F>
+		void parallelFor(const std::size_t count, F&& func, const ParallelForOptions options = {}) {
+			if (count == 0)
+				return;
+
+			const auto grainSize = chooseGrainSize(count, options);
+			const auto rangeCount = (count + grainSize - 1) / grainSize;
+
+			Completion completion(rangeCount);
+
+			for (std::size_t range = 0; range < rangeCount; ++range)
+			{
+				const auto begin = range * grainSize;
+				const auto end = std::min(count, begin + grainSize);
+
+				Task task = [ &completion, &func, begin, end ] {
+					try {
+						func(begin, end);
+					} catch (...) {
+						completion.fail(std::current_exception());
+					}
+
+					completion.finishOne();
+				};
+
+				if (options.deterministic)
+					pushPinned(range % getThreadCount(), std::move(task));
+				else
+					submit(std::move(task));
+			}
+
+			waitFor(completion);
+		}
+
+	private:
+		/*
+		 *  Completion: Count of unfinished tasks, with the first exception thrown by any of them.
+		 */
+		class Completion
+		{
+		public:
+			Completion(const std::size_t taskCount) : _remaining(taskCount) {}
+
+			void finishOne();
+			void fail(std::exception_ptr error);
+
+			bool isDone() const;
+			void rethrowIfFailed();
+
+		private:
+			std::atomic<std::size_t> _remaining;
+
+			std::mutex				 _errorMutex;
+			std::exception_ptr		 _error;
+		};
+
+		struct Worker {
+			std::mutex				 mutex;
+			std::deque<Task>		 tasks;
+			// Tasks only this worker may run (deterministic parallelFor()).
+			std::deque<Task>		 pinned;
+			std::atomic<std::size_t> pinnedCount{0};
+		};
+
+		std::size_t chooseGrainSize(const std::size_t count, const ParallelForOptions& options) const;
+
+		void pushPinned(const std::size_t worker, Task task);
+
+		/*
+		 *  runPendingTask(): Run one task available to calling thread, if any.
+		 *  				  Workers check their pinned tasks, then own deque, then steal. Other threads only steal.
+		 */
+		bool runPendingTask();
+
+		void waitFor(Completion& completion);
+		void workerLoop(const std::size_t index);
+		bool tryPop(const std::size_t worker, Task& task);
+		bool trySteal(const std::size_t thief, Task& task);
+		void wakeWorkers();
+
+		std::vector<std::unique_ptr<Worker>> _workers;
+		std::vector<std::thread>			 _threads;
+
+		std::mutex							 _sleepMutex;
+		std::condition_variable				 _wakeCondition;
+		std::atomic<std::size_t>			 _stealableCount{0};
+		std::atomic<std::size_t>			 _nextWorker{0};
+		bool								 _stopping = false;
+	};
+}
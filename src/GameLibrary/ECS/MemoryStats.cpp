@@ -0,0 +1,69 @@
+#include "GameLibrary/ECS/MemoryStats.h"
+
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+
+using namespace GameLibrary::ECS;
+
+
+namespace
+{
+	void printRow(std::ostream& out, const std::size_t nameWidth, const MemoryUsage& usage) {
+		constexpr double bytesPerKib = 1024.0;
+
+		out << std::left << std::setw(static_cast<int>(nameWidth)) << usage.name << std::right
+			<< std::setw(12) << usage.count
+			<< std::setw(14) << static_cast<double>(usage.bytesUsed) / bytesPerKib
+			<< std::setw(14) << static_cast<double>(usage.bytesReserved) / bytesPerKib
+			<< std::setw(14) << usage.getFragmentation() * 100.0 << "%\n";
+	}
+}
+
+std::size_t MemoryStats::getBytesUsed() const {
+	auto bytes = entities.bytesUsed + storage.bytesUsed;
+	for (const auto& usage : components)
+		bytes += usage.bytesUsed;
+
+	return bytes;
+}
+
+std::size_t MemoryStats::getBytesReserved() const {
+	auto bytes = entities.bytesReserved + storage.bytesReserved;
+	for (const auto& usage : components)
+		bytes += usage.bytesReserved;
+
+	return bytes;
+}
+
+void GameLibrary::ECS::printMemoryStats(std::ostream& out, const MemoryStats& stats) {
+	std::vector<const MemoryUsage*> components;
+	for (const auto& usage : stats.components)
+		components.emplace_back(&usage);
+
+	std::stable_sort(std::begin(components), std::end(components), [ ] ( const MemoryUsage* first, const MemoryUsage* second ) {
+		return first->bytesReserved > second->bytesReserved;
+	});
+
+	std::size_t nameWidth = std::max({ stats.entities.name.size(), stats.storage.name.size(), std::string("Total").size() });
+	for (const auto* usage : components)
+		nameWidth = std::max(nameWidth, usage->name.size());
+	nameWidth += 2;
+
+	// Formatted separately, so flags and precision of out are left untouched.
+	std::ostringstream table;
+	table << std::fixed << std::setprecision(1);
+
+	table << "Entities: " << stats.entities.count << " alive, " << stats.entitySlots << " slots, " << stats.freeEntitySlots << " free\n";
+	table << std::left << std::setw(static_cast<int>(nameWidth)) << "Name" << std::right
+		  << std::setw(12) << "Count" << std::setw(14) << "Used KiB" << std::setw(14) << "Reserved KiB" << std::setw(15) << "Fragmentation" << '\n';
+
+	printRow(table, nameWidth, stats.entities);
+	printRow(table, nameWidth, stats.storage);
+	for (const auto* usage : components)
+		printRow(table, nameWidth, *usage);
+
+	printRow(table, nameWidth, MemoryUsage{ "Total", stats.entities.count, stats.getBytesUsed(), stats.getBytesReserved() });
+
+	out << table.str();
+}
@@ -0,0 +1,18 @@
+#include "GameLibrary/ECS/MemoryStatsCommand.h"
+
+using namespace GameLibrary::ECS;
+
+
+MemoryStatsCommand::MemoryStatsCommand(Console::Console& console, const Console::Id id, const EntityManager& mgr, std::ostream& out)
+	: ConsoleObject(console, id), _mgr(mgr), _out(out) {}
+
+GameLibrary::Console::CommandInfoCollection MemoryStatsCommand::getCommandInfos() {
+	Console::CommandInfoCollection ret;
+	ret.emplace_back(commandName, 0, "Prints memory used by entities and each component pool.");
+
+	return ret;
+}
+
+void MemoryStatsCommand::onCreation() {
+	addCommandListener(commandName, [ this ] { printMemoryStats(_out, _mgr.getMemoryStats()); });
+}
@@ -0,0 +1,215 @@
+#include "GameLibrary/ECS/Scheduler.h"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <memory>
+#include <mutex>
+
+#include "GameLibrary/Exceptions/Standard.h"
+
+using namespace GameLibrary::ECS;
+
+
+namespace
+{
+	// Check if two sorted vectors have a common element.
+	bool intersect(const std::vector<std::size_t>& first, const std::vector<std::size_t>& second) {
+		auto firstIt = std::cbegin(first);
+		auto secondIt = std::cbegin(second);
+
+		while (firstIt != std::cend(first) && secondIt != std::cend(second))
+		{
+			if (*firstIt == *secondIt)
+				return true;
+
+			if (*firstIt < *secondIt)
+				++firstIt;
+			else
+				++secondIt;
+		}
+
+		return false;
+	}
+
+	void sortUnique(std::vector<std::size_t>& values) {
+		std::sort(std::begin(values), std::end(values));
+		values.erase(std::unique(std::begin(values), std::end(values)), std::end(values));
+	}
+}
+
+
+struct Scheduler::Frame {
+	explicit Frame(const std::size_t systemCount)
+			: remainingDependencies(std::make_unique<std::atomic<std::size_t>[]>(systemCount)),
+			  cancelled(std::make_unique<std::atomic<bool>[]>(systemCount)) {}
+
+	Clock::time_point							  start = Clock::now();
+	std::unique_ptr<std::atomic<std::size_t>[]> remainingDependencies;
+	// Set for systems depending on a failed system.
+	std::unique_ptr<std::atomic<bool>[]>		  cancelled;
+	std::atomic<std::size_t>					  finishedCount{0};
+
+	std::mutex									  errorMutex;
+	std::exception_ptr							  error;
+};
+
+
+Scheduler::SystemId Scheduler::addSystem(std::string name, std::vector<std::size_t> reads, std::vector<std::size_t> writes, Function function) {
+	if (!function)
+		throw Exceptions::InvalidArgument("ECS::Scheduler::addSystem() failed: System function is empty.");
+
+	sortUnique(reads);
+	sortUnique(writes);
+
+	const auto id = _systems.size();
+	auto& system = _systems.emplace_back(System{ std::move(name), std::move(reads), std::move(writes), std::move(function), {}, {}, {} });
+
+	for (SystemId earlier = 0; earlier < id; ++earlier)
+	{
+		if (conflicts(_systems[earlier], system))
+		{
+			system.dependencies.emplace_back(earlier);
+			_systems[earlier].dependents.emplace_back(id);
+		}
+	}
+
+	return id;
+}
+
+void Scheduler::run() {
+	for (auto& system : _systems)
+		system.timing = {};
+
+	const auto start = Clock::now();
+
+	for (auto& system : _systems)
+	{
+		system.timing.start = Clock::now() - start;
+		system.function();
+		system.timing.finish = Clock::now() - start;
+	}
+}
+
+void Scheduler::run(Utilities::ThreadPool& threadPool) {
+	if (_systems.empty())
+		return;
+
+	Frame frame(_systems.size());
+
+	for (SystemId id = 0; id < _systems.size(); ++id)
+	{
+		_systems[id].timing = {};
+		frame.remainingDependencies[id].store(_systems[id].dependencies.size(), std::memory_order_relaxed);
+		frame.cancelled[id].store(false, std::memory_order_relaxed);
+	}
+
+	for (SystemId id = 0; id < _systems.size(); ++id)
+	{
+		if (_systems[id].dependencies.empty())
+			threadPool.submit([ this, &threadPool, &frame, id ] { runSystem(threadPool, frame, id); });
+	}
+
+	threadPool.waitUntil([ this, &frame ] { return frame.finishedCount.load(std::memory_order_acquire) == _systems.size(); });
+
+	if (frame.error)
+		std::rethrow_exception(frame.error);
+}
+
+std::size_t Scheduler::getSystemCount() const {
+	return _systems.size();
+}
+
+const std::string& Scheduler::getName(const SystemId id) const {
+	return _systems.at(id).name;
+}
+
+const std::vector<Scheduler::SystemId>& Scheduler::getDependencies(const SystemId id) const {
+	return _systems.at(id).dependencies;
+}
+
+const Scheduler::SystemTiming& Scheduler::getTiming(const SystemId id) const {
+	return _systems.at(id).timing;
+}
+
+std::vector<Scheduler::SystemId> Scheduler::getCriticalPath() const {
+	if (_systems.empty())
+		return {};
+
+	// Dependencies always precede their dependents, so order of addition is a topological order.
+	std::vector<Clock::duration> pathDurations(_systems.size());
+	std::vector<SystemId> predecessors(_systems.size(), _systems.size());
+
+	for (SystemId id = 0; id < _systems.size(); ++id)
+	{
+		Clock::duration longestDependency{};
+
+		for (const auto dependency : _systems[id].dependencies)
+		{
+			if (pathDurations[dependency] > longestDependency || predecessors[id] == _systems.size())
+			{
+				longestDependency = pathDurations[dependency];
+				predecessors[id] = dependency;
+			}
+		}
+
+		pathDurations[id] = longestDependency + _systems[id].timing.getDuration();
+	}
+
+	auto last = static_cast<SystemId>(std::distance(std::cbegin(pathDurations), std::max_element(std::cbegin(pathDurations), std::cend(pathDurations))));
+
+	std::vector<SystemId> path;
+	for (; last != _systems.size(); last = predecessors[last])
+		path.emplace_back(last);
+
+	std::reverse(std::begin(path), std::end(path));
+
+	return path;
+}
+
+Scheduler::Clock::duration Scheduler::getCriticalPathDuration() const {
+	Clock::duration duration{};
+
+	for (const auto id : getCriticalPath())
+		duration += _systems[id].timing.getDuration();
+
+	return duration;
+}
+
+bool Scheduler::conflicts(const System& first, const System& second) {
+	return intersect(first.writes, second.writes) || intersect(first.writes, second.reads) || intersect(first.reads, second.writes);
+}
+
+void Scheduler::runSystem(Utilities::ThreadPool& threadPool, Frame& frame, const SystemId id) {
+	auto& system = _systems[id];
+	bool failed = frame.cancelled[id].load(std::memory_order_acquire);
+
+	if (!failed)
+	{
+		system.timing.start = Clock::now() - frame.start;
+
+		try {
+			system.function();
+		} catch (...) {
+			std::lock_guard lock(frame.errorMutex);
+
+			if (!frame.error)
+				frame.error = std::current_exception();
+			failed = true;
+		}
+
+		system.timing.finish = Clock::now() - frame.start;
+	}
+
+	for (const auto dependent : system.dependents)
+	{
+		if (failed)
+			frame.cancelled[dependent].store(true, std::memory_order_release);
+
+		if (frame.remainingDependencies[dependent].fetch_sub(1, std::memory_order_acq_rel) == 1)
+			threadPool.submit([ this, &threadPool, &frame, dependent ] { runSystem(threadPool, frame, dependent); });
+	}
+
+	// Last access to frame - run() may return right after.
+	frame.finishedCount.fetch_add(1, std::memory_order_acq_rel);
+}
@@ -0,0 +1,352 @@
+#include "GameLibrary/Physics/DynamicAabbTree.h"
+
+#include <algorithm>
+
+#include "GameLibrary/Exceptions/Standard.h"
+
+using namespace GameLibrary::Physics;
+
+
+DynamicAabbTree::DynamicAabbTree(const float margin) : _margin(margin) {
+	if (!(margin >= 0.0f))
+		throw Exceptions::InvalidArgument("Physics::DynamicAabbTree::DynamicAabbTree() failed: Margin must not be negative.");
+}
+
+
+DynamicAabbTree::ProxyId DynamicAabbTree::createProxy(const Aabb& bounds, const ECS::EntityId id, const bool isStatic) {
+	const auto proxy = allocateNode();
+
+	_nodes[proxy].fatBounds = bounds.fattened(_margin);
+	_nodes[proxy].height = 0;
+	_leaves[proxy] = { bounds, id, isStatic };
+
+	insertLeaf(proxy);
+	++_proxyCount;
+
+	return proxy;
+}
+
+void DynamicAabbTree::destroyProxy(const ProxyId proxy) {
+	removeLeaf(proxy);
+	freeNode(proxy);
+	--_proxyCount;
+}
+
+void DynamicAabbTree::setStatic(const ProxyId proxy, const bool isStatic) {
+	if (_leaves[proxy].isStatic == isStatic)
+		return;
+
+	// Move leaf to the other tree.
+	removeLeaf(proxy);
+	_leaves[proxy].isStatic = isStatic;
+	insertLeaf(proxy);
+}
+
+bool DynamicAabbTree::moveProxy(const ProxyId proxy, const Aabb& bounds) {
+	_leaves[proxy].bounds = bounds;
+	if (_nodes[proxy].fatBounds.contains(bounds))
+		return false;
+
+	removeLeaf(proxy);
+	_nodes[proxy].fatBounds = bounds.fattened(_margin);
+	insertLeaf(proxy);
+
+	return true;
+}
+
+
+void DynamicAabbTree::findPairs(PairBuffer& pairs) const {
+	pairs.clear();
+	if (_dynamicRoot == nullProxy)
+		return;
+
+	// Dynamic tree is tested against itself (pairs within node are pairs within each child, plus pairs across children),
+	// and against static tree. Every two subtrees are visited at most once, static tree is only entered where dynamic boxes are.
+	_stack.clear();
+	_stack.emplace_back(_dynamicRoot, _dynamicRoot);
+	if (_staticRoot != nullProxy)
+		_stack.emplace_back(_dynamicRoot, _staticRoot);
+
+	while (!_stack.empty())
+	{
+		const auto [first, second] = _stack.back();
+		_stack.pop_back();
+
+		const auto& a = _nodes[first];
+		const auto& b = _nodes[second];
+
+		if (first == second)
+		{
+			if (!a.isLeaf())
+			{
+				_stack.emplace_back(a.left, a.left);
+				_stack.emplace_back(a.right, a.right);
+				_stack.emplace_back(a.left, a.right);
+			}
+
+			continue;
+		}
+
+		if (!a.fatBounds.overlaps(b.fatBounds))
+			continue;
+
+		if (a.isLeaf() && b.isLeaf())
+		{
+			if (_leaves[first].bounds.overlaps(_leaves[second].bounds))
+				pairs.emplace_back(makeOverlapPair(_leaves[first].id, _leaves[second].id));
+		}
+		// Descend into the taller subtree.
+		else if (b.isLeaf() || (!a.isLeaf() && a.height >= b.height))
+		{
+			_stack.emplace_back(a.left, second);
+			_stack.emplace_back(a.right, second);
+		}
+		else
+		{
+			_stack.emplace_back(first, b.left);
+			_stack.emplace_back(first, b.right);
+		}
+	}
+}
+
+
+void DynamicAabbTree::set(const ECS::EntityId id, const Aabb& bounds, const bool isStatic) {
+	const auto index = ECS::getEntityIndex(id);
+
+	if (index < _proxies.size() && _proxies[index] != nullProxy)
+	{
+		const auto proxy = _proxies[index];
+
+		if (_leaves[proxy].id == id)
+		{
+			moveProxy(proxy, bounds);
+			setStatic(proxy, isStatic);
+
+			return;
+		}
+
+		destroyProxy(proxy);
+	}
+
+	if (index >= _proxies.size())
+		_proxies.resize(index + 1, nullProxy);
+
+	_proxies[index] = createProxy(bounds, id, isStatic);
+}
+
+void DynamicAabbTree::remove(const ECS::EntityId id) {
+	if (!contains(id))
+		return;
+
+	const auto index = ECS::getEntityIndex(id);
+	destroyProxy(_proxies[index]);
+	_proxies[index] = nullProxy;
+}
+
+bool DynamicAabbTree::contains(const ECS::EntityId id) const {
+	const auto index = ECS::getEntityIndex(id);
+
+	return index < _proxies.size() && _proxies[index] != nullProxy && _leaves[_proxies[index]].id == id;
+}
+
+void DynamicAabbTree::clear() {
+	_nodes.clear();
+	_leaves.clear();
+	_proxies.clear();
+	_dynamicRoot = nullProxy;
+	_staticRoot = nullProxy;
+	_freeList = nullProxy;
+	_proxyCount = 0;
+}
+
+
+DynamicAabbTree::ProxyId DynamicAabbTree::allocateNode() {
+	if (_freeList == nullProxy)
+	{
+		_nodes.emplace_back();
+		_leaves.emplace_back();
+		return static_cast<ProxyId>(_nodes.size() - 1);
+	}
+
+	const auto index = _freeList;
+	_freeList = _nodes[index].parent;
+	_nodes[index] = Node();
+
+	return index;
+}
+
+void DynamicAabbTree::freeNode(const ProxyId index) {
+	_nodes[index].parent = _freeList;
+	_nodes[index].height = -1;
+	_freeList = index;
+}
+
+
+void DynamicAabbTree::insertLeaf(const ProxyId leaf) {
+	auto& root = rootOf(leaf);
+
+	if (root == nullProxy)
+	{
+		root = leaf;
+		_nodes[leaf].parent = nullProxy;
+
+		return;
+	}
+
+	// Descend towards sibling minimizing increase of perimeters (surface area heuristic).
+	const auto leafBounds = _nodes[leaf].fatBounds;
+	auto index = root;
+
+	while (!_nodes[index].isLeaf())
+	{
+		const auto& node = _nodes[index];
+		const auto combinedPerimeter = Aabb::merge(node.fatBounds, leafBounds).getPerimeter();
+
+		// Cost of making leaf sibling of this node, and minimal cost pushed down to children.
+		const auto cost = 2.0f * combinedPerimeter;
+		const auto inheritedCost = 2.0f * (combinedPerimeter - node.fatBounds.getPerimeter());
+
+		const auto descendCost = [ this, &leafBounds, inheritedCost ] ( const ProxyId child ) {
+			const auto& childBounds = _nodes[child].fatBounds;
+			const auto mergedPerimeter = Aabb::merge(leafBounds, childBounds).getPerimeter();
+
+			return _nodes[child].isLeaf() ? mergedPerimeter + inheritedCost : (mergedPerimeter - childBounds.getPerimeter()) + inheritedCost;
+		};
+		const auto leftCost = descendCost(node.left);
+		const auto rightCost = descendCost(node.right);
+
+		if (cost < leftCost && cost < rightCost)
+			break;
+
+		index = (leftCost < rightCost) ? node.left : node.right;
+	}
+
+	const auto sibling = index;
+	const auto oldParent = _nodes[sibling].parent;
+	const auto newParent = allocateNode();
+
+	auto& parentNode = _nodes[newParent];
+	parentNode.parent = oldParent;
+	parentNode.fatBounds = Aabb::merge(leafBounds, _nodes[sibling].fatBounds);
+	parentNode.height = _nodes[sibling].height + 1;
+	parentNode.left = sibling;
+	parentNode.right = leaf;
+
+	if (oldParent == nullProxy)
+		rootOf(leaf) = newParent;
+	else if (_nodes[oldParent].left == sibling)
+		_nodes[oldParent].left = newParent;
+	else
+		_nodes[oldParent].right = newParent;
+
+	_nodes[sibling].parent = newParent;
+	_nodes[leaf].parent = newParent;
+
+	refitUpwards(newParent);
+}
+
+void DynamicAabbTree::removeLeaf(const ProxyId leaf) {
+	auto& root = rootOf(leaf);
+
+	if (leaf == root)
+	{
+		root = nullProxy;
+		return;
+	}
+
+	const auto parent = _nodes[leaf].parent;
+	const auto grandParent = _nodes[parent].parent;
+	const auto sibling = (_nodes[parent].left == leaf) ? _nodes[parent].right : _nodes[parent].left;
+
+	freeNode(parent);
+
+	if (grandParent == nullProxy)
+	{
+		root = sibling;
+		_nodes[sibling].parent = nullProxy;
+
+		return;
+	}
+
+	if (_nodes[grandParent].left == parent)
+		_nodes[grandParent].left = sibling;
+	else
+		_nodes[grandParent].right = sibling;
+	_nodes[sibling].parent = grandParent;
+
+	refitUpwards(grandParent);
+}
+
+void DynamicAabbTree::refitUpwards(ProxyId index) {
+	while (index != nullProxy)
+	{
+		index = balance(index);
+
+		auto& node = _nodes[index];
+		const auto& left = _nodes[node.left];
+		const auto& right = _nodes[node.right];
+
+		node.height = 1 + std::max(left.height, right.height);
+		node.fatBounds = Aabb::merge(left.fatBounds, right.fatBounds);
+
+		index = node.parent;
+	}
+}
+
+DynamicAabbTree::ProxyId DynamicAabbTree::balance(const ProxyId indexA) {
+	auto& a = _nodes[indexA];
+	if (a.isLeaf() || a.height < 2)
+		return indexA;
+
+	const auto indexB = a.left;
+	const auto indexC = a.right;
+	auto& b = _nodes[indexB];
+	auto& c = _nodes[indexC];
+	const auto imbalance = c.height - b.height;
+
+	if (imbalance >= -1 && imbalance <= 1)
+		return indexA;
+
+	// Rotate taller child up in place of A. A keeps the shorter child, and takes one of rotated child's children.
+	const auto rotateUp = [ this, indexA, &a ] ( const ProxyId indexUp, const ProxyId indexKept, ProxyId Node::* slotInA ) {
+		auto& up = _nodes[indexUp];
+		const auto indexF = up.left;
+		const auto indexG = up.right;
+		auto& f = _nodes[indexF];
+		auto& g = _nodes[indexG];
+
+		up.left = indexA;
+		up.parent = a.parent;
+		a.parent = indexUp;
+
+		if (up.parent == nullProxy)
+			((_staticRoot == indexA) ? _staticRoot : _dynamicRoot) = indexUp;
+		else if (_nodes[up.parent].left == indexA)
+			_nodes[up.parent].left = indexUp;
+		else
+			_nodes[up.parent].right = indexUp;
+
+		// Taller grandchild stays under rotated node, shorter one moves to A.
+		const auto indexTaller = (f.height > g.height) ? indexF : indexG;
+		const auto indexShorter = (f.height > g.height) ? indexG : indexF;
+
+		up.right = indexTaller;
+		a.*slotInA = indexShorter;
+		_nodes[indexShorter].parent = indexA;
+
+		const auto& kept = _nodes[indexKept];
+		a.fatBounds = Aabb::merge(kept.fatBounds, _nodes[indexShorter].fatBounds);
+		a.height = 1 + std::max(kept.height, _nodes[indexShorter].height);
+		up.fatBounds = Aabb::merge(a.fatBounds, _nodes[indexTaller].fatBounds);
+		up.height = 1 + std::max(a.height, _nodes[indexTaller].height);
+	};
+
+	if (imbalance > 1)
+	{
+		rotateUp(indexC, indexB, &Node::right);
+		return indexC;
+	}
+
+	rotateUp(indexB, indexC, &Node::left);
+	return indexB;
+}
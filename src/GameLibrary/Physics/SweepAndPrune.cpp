@@ -0,0 +1,59 @@
+#include "GameLibrary/Physics/SweepAndPrune.h"
+
+#include <algorithm>
+
+using namespace GameLibrary::Physics;
+
+
+void SweepAndPrune::findPairs(PairBuffer& pairs) {
+	pairs.clear();
+	if (_boxes.size() < 2)
+		return;
+
+	// Sweep along axis with larger variance of box centers - fewer boxes overlap in projection on it.
+	double sumX = 0.0, sumY = 0.0, sumSquaredX = 0.0, sumSquaredY = 0.0;
+	for (const auto& box : _boxes)
+	{
+		const double centerX = 0.5 * (box.bounds.minX + box.bounds.maxX);
+		const double centerY = 0.5 * (box.bounds.minY + box.bounds.maxY);
+
+		sumX += centerX;
+		sumY += centerY;
+		sumSquaredX += centerX * centerX;
+		sumSquaredY += centerY * centerY;
+	}
+	const auto count = static_cast<double>(_boxes.size());
+	const auto sweepX = (sumSquaredX - sumX * sumX / count) >= (sumSquaredY - sumY * sumY / count);
+
+	_projections.clear();
+	_projections.reserve(_boxes.size());
+	for (const auto& box : _boxes)
+	{
+		const auto& b = box.bounds;
+
+		if (sweepX)
+			_projections.push_back({ b.minX, b.maxX, b.minY, b.maxY, box.id, box.isStatic });
+		else
+			_projections.push_back({ b.minY, b.maxY, b.minX, b.maxX, box.id, box.isStatic });
+	}
+
+	std::sort(std::begin(_projections), std::end(_projections), [ ] ( const Projection& first, const Projection& second ) {
+		return first.min < second.min;
+	});
+
+	const auto end = _projections.size();
+	for (std::size_t i = 0; i < end; ++i)
+	{
+		const auto& current = _projections[i];
+
+		for (auto j = i + 1; j < end && _projections[j].min <= current.max; ++j)
+		{
+			const auto& other = _projections[j];
+
+			if (current.isStatic && other.isStatic)
+				continue;
+			if (current.otherMin <= other.otherMax && other.otherMin <= current.otherMax)
+				pairs.emplace_back(makeOverlapPair(current.id, other.id));
+		}
+	}
+}
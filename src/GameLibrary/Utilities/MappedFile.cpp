@@ -0,0 +1,76 @@
+#include "GameLibrary/Utilities/MappedFile.h"
+
+#include <fstream>
+
+#include "GameLibrary/Exceptions/Standard.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+	#include <fcntl.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <unistd.h>
+
+	#define GAMELIBRARY_HAS_MMAP 1
+#endif
+
+using namespace GameLibrary::Utilities;
+
+
+MappedFile::MappedFile(const std::string& path) {
+#ifdef GAMELIBRARY_HAS_MMAP
+	const auto descriptor = ::open(path.c_str(), O_RDONLY);
+	if (descriptor < 0)
+		throw Exceptions::IoError("Utilities::MappedFile::MappedFile() failed: Couldn't open \"" + path + "\".");
+
+	struct stat status{};
+	if (::fstat(descriptor, &status) != 0)
+	{
+		::close(descriptor);
+		throw Exceptions::IoError("Utilities::MappedFile::MappedFile() failed: Couldn't read size of \"" + path + "\".");
+	}
+
+	_size = static_cast<std::size_t>(status.st_size);
+
+	// Empty files can't be mapped - they are represented by null data.
+	if (_size > 0)
+	{
+		void* mapping = ::mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+		if (mapping == MAP_FAILED)
+		{
+			::close(descriptor);
+			throw Exceptions::IoError("Utilities::MappedFile::MappedFile() failed: Couldn't map \"" + path + "\".");
+		}
+
+		// Whole file is usually consumed front to back - let the OS read ahead aggressively.
+		// Advice values are enumerators, not flags, so each needs its own call. Advice is only a hint - failure is harmless.
+		static_cast<void>(::madvise(mapping, _size, MADV_SEQUENTIAL));
+		static_cast<void>(::madvise(mapping, _size, MADV_WILLNEED));
+
+		_data = static_cast<const std::byte*>(mapping);
+		_isMapped = true;
+	}
+
+	// Mapping stays valid after the descriptor is closed.
+	::close(descriptor);
+#else
+	std::ifstream file(path, std::ios::binary | std::ios::ate);
+	if (!file)
+		throw Exceptions::IoError("Utilities::MappedFile::MappedFile() failed: Couldn't open \"" + path + "\".");
+
+	_size = static_cast<std::size_t>(file.tellg());
+	_buffer.resize(_size);
+
+	file.seekg(0);
+	if (!file.read(reinterpret_cast<char*>(_buffer.data()), static_cast<std::streamsize>(_size)))
+		throw Exceptions::IoError("Utilities::MappedFile::MappedFile() failed: Couldn't read \"" + path + "\".");
+
+	_data = _buffer.data();
+#endif
+}
+
+MappedFile::~MappedFile() {
+#ifdef GAMELIBRARY_HAS_MMAP
+	if (_isMapped)
+		::munmap(const_cast<std::byte*>(_data), _size);
+#endif
+}
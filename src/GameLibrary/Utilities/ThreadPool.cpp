@@ -0,0 +1,202 @@
+#include "GameLibrary/Utilities/ThreadPool.h"
+
+#include "GameLibrary/Exceptions/Standard.h"
+
+using namespace GameLibrary::Utilities;
+
+
+namespace
+{
+	// Identifies the pool and worker index of calling thread, if it is a worker.
+	thread_local const ThreadPool* currentPool = nullptr;
+	thread_local std::size_t currentWorker = 0;
+}
+
+
+void ThreadPool::Completion::finishOne() {
+	_remaining.fetch_sub(1, std::memory_order_acq_rel);
+}
+
+void ThreadPool::Completion::fail(std::exception_ptr error) {
+	std::lock_guard lock(_errorMutex);
+
+	if (!_error)
+		_error = std::move(error);
+}
+
+bool ThreadPool::Completion::isDone() const {
+	return _remaining.load(std::memory_order_acquire) == 0;
+}
+
+void ThreadPool::Completion::rethrowIfFailed() {
+	std::lock_guard lock(_errorMutex);
+
+	if (_error)
+		std::rethrow_exception(_error);
+}
+
+ThreadPool::ThreadPool(const std::size_t threadCount) {
+	if (threadCount == 0)
+		throw Exceptions::InvalidArgument("Utilities::ThreadPool::ThreadPool() failed: Thread count must be positive.");
+
+	for (std::size_t i = 0; i < threadCount; ++i)
+		_workers.emplace_back(std::make_unique<Worker>());
+
+	for (std::size_t i = 0; i < threadCount; ++i)
+		_threads.emplace_back([ this, i ] { workerLoop(i); });
+}
+
+ThreadPool::~ThreadPool() {
+	{
+		std::lock_guard lock(_sleepMutex);
+		_stopping = true;
+	}
+	_wakeCondition.notify_all();
+
+	for (auto& thread : _threads)
+		thread.join();
+}
+
+std::size_t ThreadPool::getDefaultThreadCount() {
+	return std::max(1u, std::thread::hardware_concurrency());
+}
+
+std::size_t ThreadPool::getThreadCount() const {
+	return _workers.size();
+}
+
+void ThreadPool::submit(Task task) {
+	const auto worker = (currentPool == this) ? currentWorker : (_nextWorker++ % getThreadCount());
+
+	{
+		std::lock_guard lock(_workers[worker]->mutex);
+		_workers[worker]->tasks.emplace_back(std::move(task));
+	}
+
+	_stealableCount.fetch_add(1, std::memory_order_release);
+	wakeWorkers();
+}
+
+std::size_t ThreadPool::chooseGrainSize(const std::size_t count, const ParallelForOptions& options) const {
+	if (options.grainSize > 0)
+		return options.grainSize;
+
+	if (options.deterministic)
+		return (count + getThreadCount() - 1) / getThreadCount();
+
+	// A few ranges per worker leave room for stealing to even out uneven ranges.
+	constexpr std::size_t rangesPerWorker = 4;
+
+	return std::max<std::size_t>(1, count / (getThreadCount() * rangesPerWorker));
+}
+
+void ThreadPool::pushPinned(const std::size_t worker, Task task) {
+	auto& target = *_workers[worker];
+
+	{
+		std::lock_guard lock(target.mutex);
+		target.pinned.emplace_back(std::move(task));
+	}
+
+	target.pinnedCount.fetch_add(1, std::memory_order_release);
+	wakeWorkers();
+}
+
+bool ThreadPool::runPendingTask() {
+	Task task;
+	const bool isWorker = (currentPool == this);
+
+	if ((isWorker && tryPop(currentWorker, task)) || trySteal(isWorker ? currentWorker : getThreadCount(), task))
+	{
+		task();
+		return true;
+	}
+
+	return false;
+}
+
+void ThreadPool::waitFor(Completion& completion) {
+	waitUntil([ &completion ] { return completion.isDone(); });
+
+	completion.rethrowIfFailed();
+}
+
+void ThreadPool::workerLoop(const std::size_t index) {
+	currentPool = this;
+	currentWorker = index;
+
+	auto& self = *_workers[index];
+
+	while (true)
+	{
+		if (runPendingTask())
+			continue;
+
+		std::unique_lock lock(_sleepMutex);
+		_wakeCondition.wait(lock, [ this, &self ] {
+			return _stopping || _stealableCount.load(std::memory_order_acquire) > 0 || self.pinnedCount.load(std::memory_order_acquire) > 0;
+		});
+
+		if (_stopping)
+			return;
+	}
+}
+
+bool ThreadPool::tryPop(const std::size_t worker, Task& task) {
+	auto& owner = *_workers[worker];
+	std::lock_guard lock(owner.mutex);
+
+	if (!owner.pinned.empty())
+	{
+		task = std::move(owner.pinned.front());
+		owner.pinned.pop_front();
+		owner.pinnedCount.fetch_sub(1, std::memory_order_acq_rel);
+
+		return true;
+	}
+
+	if (!owner.tasks.empty())
+	{
+		task = std::move(owner.tasks.back());
+		owner.tasks.pop_back();
+		_stealableCount.fetch_sub(1, std::memory_order_acq_rel);
+
+		return true;
+	}
+
+	return false;
+}
+
+bool ThreadPool::trySteal(const std::size_t thief, Task& task) {
+	if (_stealableCount.load(std::memory_order_acquire) == 0)
+		return false;
+
+	const auto count = getThreadCount();
+
+	// Start with thief's neighbour, so thieves don't all pile onto worker 0.
+	for (std::size_t offset = 1; offset <= count; ++offset)
+	{
+		auto& victim = *_workers[(thief + offset) % count];
+		std::lock_guard lock(victim.mutex);
+
+		if (!victim.tasks.empty())
+		{
+			task = std::move(victim.tasks.front());
+			victim.tasks.pop_front();
+			_stealableCount.fetch_sub(1, std::memory_order_acq_rel);
+
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void ThreadPool::wakeWorkers() {
+	// Locking makes sure no worker is between checking its wait condition and going to sleep.
+	{
+		std::lock_guard lock(_sleepMutex);
+	}
+
+	_wakeCondition.notify_all();
+}
@@ -0,0 +1,146 @@
+#include "GameLibrary/ECS/Storage/ArchetypeStorage.h"
+
+#include <map>
+#include <string>
+
+#include "catch2/catch.hpp"
+
+#include "GameLibrary/ECS/Entity.h"
+#include "GameLibrary/ECS/EntityManager.h"
+#include "GameLibrary/Exceptions/Standard.h"
+
+using namespace GameLibrary;
+using namespace GameLibrary::ECS;
+
+
+namespace
+{
+	EntityId entity(const EntityId::Index index) {
+		return EntityId(index, 0);
+	}
+
+	struct Position {
+		int x = 0; int y = 0;
+	};
+	struct Name {
+		std::string value;
+	};
+	struct Heavy {
+		char bytes[6000];
+	};
+}
+
+
+TEST_CASE("ArchetypeStorage stores components by value, and keeps them intact while entities move between archetypes.", "[ECS]")
+{
+	ArchetypeStorage storage;
+
+	storage.insert(entity(0), Position{ 1, 2 });
+	storage.insert(entity(1), Position{ 3, 4 }, Name{ "second" });
+	REQUIRE(storage.getArchetypeCount() == 2);
+
+	// Moves entity 0 to archetype of entity 1.
+	storage.add<Name>(entity(0), Name{ "first" });
+	REQUIRE(storage.getArchetypeCount() == 2);
+
+	REQUIRE(storage.get<Position>(entity(0)).x == 1);
+	REQUIRE(storage.get<Name>(entity(0)).value == "first");
+	REQUIRE(storage.get<Name>(entity(1)).value == "second");
+
+	// Adding an existing component has no effect.
+	storage.add<Name>(entity(0), Name{ "ignored" });
+	REQUIRE(storage.get<Name>(entity(0)).value == "first");
+
+	storage.remove(entity(0));
+	REQUIRE_FALSE(storage.contains(entity(0)));
+	REQUIRE(storage.get<Name>(entity(1)).value == "second");
+	REQUIRE(storage.get<Position>(entity(1)).y == 4);
+
+	REQUIRE_THROWS_AS(storage.get<Heavy>(entity(1)), Exceptions::NotFoundError);
+	REQUIRE_THROWS_AS(storage.get<Position>(entity(0)), Exceptions::NotFoundError);
+}
+
+TEST_CASE("ArchetypeStorage::removeComponent() moves entity to archetype without removed component.", "[ECS]")
+{
+	ArchetypeStorage storage;
+
+	storage.insert(entity(0), Position{ 5, 6 }, Name{ "name" });
+	storage.removeComponent<Position>(entity(0));
+
+	REQUIRE_FALSE(storage.has<Position>(entity(0)));
+	REQUIRE(storage.get<Name>(entity(0)).value == "name");
+
+	// Entity left without components is removed.
+	storage.removeComponent<Name>(entity(0));
+	REQUIRE_FALSE(storage.contains(entity(0)));
+}
+
+TEST_CASE("ArchetypeStorage keeps rows packed across chunks when removing entities.", "[ECS]")
+{
+	ArchetypeStorage storage;
+	constexpr EntityId::Index entityCount = 5000;
+
+	for (EntityId::Index index = 0; index < entityCount; ++index)
+		storage.insert(entity(index), Position{ static_cast<int>(index), 0 }, Name{ std::to_string(index) });
+
+	// Remove every odd entity, forcing rows from the end to fill holes.
+	for (EntityId::Index index = 1; index < entityCount; index += 2)
+		storage.remove(entity(index));
+
+	REQUIRE(storage.size() == entityCount / 2);
+
+	std::map<EntityId::Index, int> visited;
+	storage.forEach<Name, Position>([ &visited ] ( const EntityId id, Name& name, Position& position ) {
+		REQUIRE(name.value == std::to_string(id.getIndex()));
+		visited.try_emplace(id.getIndex(), position.x);
+	});
+
+	REQUIRE(visited.size() == entityCount / 2);
+	for (const auto& [index, x] : visited)
+		REQUIRE(((index % 2 == 0) && (x == static_cast<int>(index))));
+}
+
+TEST_CASE("ArchetypeStorage::forEach() visits every archetype containing requested components.", "[ECS]")
+{
+	ArchetypeStorage storage;
+
+	storage.insert(entity(0), Position{ 1, 0 });
+	storage.insert(entity(1), Position{ 2, 0 }, Name{});
+	storage.insert(entity(2), Name{});
+	// Row bigger than a chunk still gets a (bigger) chunk of its own.
+	storage.insert(entity(3), Position{ 4, 0 }, Heavy{});
+	storage.insert(entity(4), Position{ 8, 0 }, Heavy{});
+
+	int sum = 0;
+	storage.forEach<Position>([ &sum ] ( EntityId, const Position& position ) { sum += position.x; });
+
+	REQUIRE(sum == 15);
+}
+
+TEST_CASE("ArchetypeEntityManager adds / removes entities, and reports existence of their components.", "[ECS]")
+{
+	struct PositionComponent {
+		int x; int y;
+	};
+	struct HealthComponent {
+		int health;
+	};
+	struct UnusedComponent {};
+	struct PlayerEntity : BaseEntity<PositionComponent, HealthComponent> {};
+
+	ArchetypeEntityManager mgr;
+
+	const auto firstId = mgr.addEntity<PlayerEntity>();
+	const auto secondId = mgr.addEntity<PlayerEntity>();
+
+	REQUIRE(mgr.getCount() == 2);
+	REQUIRE((mgr.entityHasComponent<PositionComponent>(firstId) && mgr.entityHasComponent<HealthComponent>(firstId)));
+	REQUIRE_FALSE(mgr.entityHasComponent<UnusedComponent>(firstId));
+
+	mgr.removeEntity(firstId);
+
+	REQUIRE(mgr.getCount() == 1);
+	REQUIRE_FALSE(mgr.entityExists(firstId));
+	REQUIRE_FALSE(mgr.entityHasComponent<PositionComponent>(firstId));
+	REQUIRE(mgr.entityExists(secondId));
+}
@@ -0,0 +1,168 @@
+#include "GameLibrary/ECS/CommandBuffer.h"
+
+#include <vector>
+
+#include "catch2/catch.hpp"
+
+#include "GameLibrary/ECS/EntityManager.h"
+#include "GameLibrary/Exceptions/Standard.h"
+#include "GameLibrary/Utilities/ThreadPool.h"
+
+using namespace GameLibrary;
+using namespace GameLibrary::ECS;
+
+
+namespace
+{
+	struct Position {
+		int x = 0; int y = 0;
+	};
+	struct Dead {};
+}
+
+
+TEST_CASE("EntityCommandBuffer defers structural changes made while iterating a View.", "[ECS]")
+{
+	EntityManager mgr;
+	EntityCommandBuffer commands;
+
+	for (int i = 0; i < 10; ++i)
+		mgr.addComponent<Position>(mgr.createEntity(), i, 0);
+
+	mgr.forEach<Position>([ &commands ] ( const EntityId id, const Position& position ) {
+		if (position.x % 2 == 0)
+		{
+			commands.addComponent<Dead>(id);
+			commands.removeComponent<Position>(id);
+		}
+		else if (position.x == 9)
+			commands.removeEntity(id);
+	});
+
+	// Nothing changes until playback.
+	REQUIRE(mgr.getCount() == 10);
+	REQUIRE(mgr.getStorage().getPool<Dead>().size() == 0);
+	REQUIRE_FALSE(commands.isEmpty());
+
+	commands.playback(mgr);
+
+	REQUIRE(commands.isEmpty());
+	REQUIRE(mgr.getCount() == 9);
+	REQUIRE(mgr.getStorage().getPool<Dead>().size() == 5);
+	REQUIRE(mgr.view<Position>().sizeHint() == 4);
+	mgr.forEach<Position>([] ( const Position& position ) { REQUIRE(position.x % 2 == 1); });
+}
+
+TEST_CASE("EntityCommandBuffer resolves placeholders of created entities at playback.", "[ECS]")
+{
+	EntityManager mgr;
+	EntityCommandBuffer commands;
+
+	const auto first = commands.createEntity();
+	const auto second = commands.createEntity();
+	REQUIRE(first.isPlaceholder());
+
+	commands.addComponent<Position>(first, 1, 2);
+	commands.addComponent<Position>(second, 3, 4);
+	commands.removeEntity(second);
+
+	const auto created = commands.playback(mgr);
+
+	REQUIRE(created.size() == 2);
+	REQUIRE(mgr.getCount() == 1);
+	REQUIRE(mgr.getComponent<Position>(created[0]).y == 2);
+	REQUIRE_FALSE(mgr.entityExists(created[1]));
+
+	// Placeholders are only meaningful to the buffer which created them.
+	commands.addComponent<Position>(second, 0, 0);
+	REQUIRE_THROWS_AS(commands.playback(mgr), Exceptions::InvalidArgument);
+}
+
+TEST_CASE("EntityCommandBuffer ignores commands on entities removed before playback.", "[ECS]")
+{
+	EntityManager mgr;
+	EntityCommandBuffer commands;
+
+	const auto id = mgr.createEntity();
+	commands.addComponent<Position>(id);
+	commands.removeEntity(id);
+	mgr.removeEntity(id);
+
+	commands.playback(mgr);
+
+	REQUIRE(mgr.getCount() == 0);
+	REQUIRE(mgr.view<Position>().sizeHint() == 0);
+}
+
+TEST_CASE("EntityCommandBuffer applies additions and removals of a component on the same entity in order of recording.", "[ECS]")
+{
+	EntityManager mgr;
+	EntityCommandBuffer commands;
+
+	const auto readded = mgr.createEntity();
+	const auto removed = mgr.createEntity();
+	mgr.addComponent<Position>(readded, 1, 1);
+
+	// Remove, then add back with a new value.
+	commands.removeComponent<Position>(readded);
+	commands.addComponent<Position>(readded, 2, 2);
+
+	// Add, then remove.
+	commands.addComponent<Position>(removed, 3, 3);
+	commands.removeComponent<Position>(removed);
+
+	commands.playback(mgr);
+
+	REQUIRE(mgr.entityHasComponent<Position>(readded));
+	REQUIRE(mgr.getComponent<Position>(readded).x == 2);
+	REQUIRE_FALSE(mgr.entityHasComponent<Position>(removed));
+}
+
+TEST_CASE("ParallelCommandBuffer merges commands recorded on ThreadPool workers.", "[ECS]")
+{
+	EntityManager mgr;
+	ParallelCommandBuffer commands;
+	Utilities::ThreadPool threadPool(4);
+
+	for (int i = 0; i < 1000; ++i)
+		mgr.addComponent<Position>(mgr.createEntity(), i, 0);
+
+	mgr.view<Position>().parallelForEach(threadPool, [ &commands ] ( const EntityId id, const Position& position ) {
+		auto& local = commands.getLocal();
+
+		if (position.x % 10 == 0)
+			local.addComponent<Position>(local.createEntity(), -1, 0);
+		else if (position.x % 10 == 1)
+			local.removeEntity(id);
+	});
+
+	const auto created = commands.playback(mgr);
+
+	REQUIRE(created.size() == 100);
+	REQUIRE(mgr.getCount() == 1000);
+	for (const auto id : created)
+		REQUIRE(mgr.getComponent<Position>(id).x == -1);
+}
+
+TEST_CASE("ParallelCommandBuffer::getLocal() returns the same buffer on every call from a thread, and a separate one per instance.", "[ECS]")
+{
+	ParallelCommandBuffer first;
+	auto& firstLocal = first.getLocal();
+
+	REQUIRE(&first.getLocal() == &firstLocal);
+
+	{
+		ParallelCommandBuffer second;
+		REQUIRE(&second.getLocal() != &firstLocal);
+		REQUIRE(&first.getLocal() == &firstLocal);
+	}
+
+	// Same address as the destroyed one is possible, it still gets a buffer of its own.
+	ParallelCommandBuffer third;
+	auto& thirdLocal = third.getLocal();
+	REQUIRE(&thirdLocal != &firstLocal);
+
+	thirdLocal.createEntity();
+	EntityManager mgr;
+	REQUIRE(third.playback(mgr).size() == 1);
+}
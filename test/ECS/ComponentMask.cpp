@@ -0,0 +1,97 @@
+#include "GameLibrary/ECS/ComponentMask.h"
+
+#include <vector>
+
+#include "catch2/catch.hpp"
+
+#include "GameLibrary/ECS/Component.h"
+#include "GameLibrary/ECS/Entity.h"
+#include "GameLibrary/ECS/EntityManager.h"
+#include "GameLibrary/Exceptions/Standard.h"
+
+using namespace GameLibrary;
+using namespace GameLibrary::ECS;
+
+
+namespace
+{
+	struct Position {
+		int x = 0; int y = 0;
+	};
+	struct Velocity {
+		int dx = 0; int dy = 0;
+	};
+	struct Dead {};
+
+	struct Mover : BaseEntity<Position, Velocity> {};
+}
+
+
+TEST_CASE("ComponentMask matches queries spanning multiple words.", "[ECS]")
+{
+	ComponentMask signature;
+	signature.set(3);
+	signature.set(70);
+	signature.set(200);
+
+	ComponentQuery query;
+	query.required.set(3);
+	query.required.set(200);
+	query.excluded.set(71);
+
+	REQUIRE(query.matches(signature));
+
+	signature.set(71);
+	REQUIRE_FALSE(query.matches(signature));
+
+	signature.reset(71);
+	signature.reset(200);
+	REQUIRE_FALSE(query.matches(signature));
+	REQUIRE(signature.test(70));
+	REQUIRE_FALSE(signature.test(ComponentMask::capacity + 10));
+
+	REQUIRE_THROWS_AS(signature.set(ComponentMask::capacity), Exceptions::OverflowError);
+
+	// Every type getting a componentIndex() fits in a signature.
+	static_assert(ComponentMask::capacity == maxComponentTypes);
+}
+
+TEST_CASE("EntityManager keeps entity signatures in sync with their components, with every storage backend.", "[ECS]")
+{
+	const auto check = [ ] ( auto& mgr ) {
+		const auto mover = mgr.template addEntity<Mover>();
+		const auto movers = mgr.template addEntities<Mover>(10);
+		const auto still = mgr.createEntity();
+		mgr.template addComponent<Position>(still);
+
+		const auto& moving = ComponentQuery::of<Position, Velocity>(exclude<Dead>);
+
+		REQUIRE(mgr.getSignature(mover) == ComponentMask::of<Position, Velocity>());
+		REQUIRE(mgr.entityMatches(movers[5], moving));
+		REQUIRE_FALSE(mgr.entityMatches(still, moving));
+
+		mgr.template addComponent<Dead>(movers[5]);
+		REQUIRE_FALSE(mgr.entityMatches(movers[5], moving));
+		mgr.template removeComponent<Dead>(movers[5]);
+		REQUIRE(mgr.entityMatches(movers[5], moving));
+
+		std::vector<EntityId> matched;
+		mgr.forEachMatching(moving, [ &matched ] ( const EntityId id ) { matched.emplace_back(id); });
+		REQUIRE(matched.size() == 11);
+
+		// Reused slot starts with an empty signature, stale handle matches nothing.
+		mgr.removeEntity(mover);
+		const auto reused = mgr.createEntity();
+		REQUIRE(mgr.getSignature(reused).none());
+		REQUIRE(mgr.getSignature(mover).none());
+		REQUIRE_FALSE(mgr.template entityHasComponent<Position>(mover));
+	};
+
+	EntityManager sparseSetMgr;
+	MapEntityManager mapMgr;
+	ArchetypeEntityManager archetypeMgr;
+
+	check(sparseSetMgr);
+	check(mapMgr);
+	check(archetypeMgr);
+}
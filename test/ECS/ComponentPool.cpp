@@ -0,0 +1,164 @@
+#include "GameLibrary/ECS/Storage/ComponentPool.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "catch2/catch.hpp"
+
+#include "GameLibrary/ECS/Storage/SparseSetStorage.h"
+#include "GameLibrary/Exceptions/Standard.h"
+
+using namespace GameLibrary;
+using namespace GameLibrary::ECS;
+
+
+namespace
+{
+	EntityId entity(const EntityId::Index index) {
+		return EntityId(index, 0);
+	}
+
+	struct Position {
+		int x = 0; int y = 0;
+	};
+	struct Velocity {
+		int dx = 0; int dy = 0;
+	};
+}
+
+
+TEST_CASE("ComponentPool adds, finds and removes components, keeping dense arrays packed.", "[ECS]")
+{
+	ComponentPool<Position> pool;
+	constexpr EntityId::Index entityCount = 100;
+
+	for (EntityId::Index index = 0; index < entityCount; ++index)
+		pool.emplace(entity(index), static_cast<int>(index), 0);
+
+	// Emplacing for an entity which already has a component has no effect.
+	REQUIRE(pool.emplace(entity(10), 1000, 1000).x == 10);
+	REQUIRE(pool.size() == entityCount);
+
+	for (EntityId::Index index = 0; index < entityCount; index += 3)
+		pool.remove(entity(index));
+
+	const auto& entities = pool.getEntities();
+	const auto& components = pool.getComponents();
+
+	REQUIRE(entities.size() == components.size());
+	for (std::size_t i = 0; i < entities.size(); ++i)
+	{
+		REQUIRE(entities[i].getIndex() % 3 != 0);
+		REQUIRE(components[i].x == static_cast<int>(entities[i].getIndex()));
+		REQUIRE(pool.find(entities[i]) == i);
+	}
+
+	REQUIRE_FALSE(pool.contains(entity(0)));
+	REQUIRE_FALSE(pool.contains(entity(entityCount + 50)));
+	// Handle with another generation doesn't refer to the same entity.
+	REQUIRE_FALSE(pool.contains(EntityId(4, 1)));
+	REQUIRE_THROWS_AS(pool.get(entity(3)), Exceptions::NotFoundError);
+	REQUIRE(pool.get(entity(4)).x == 4);
+}
+
+TEST_CASE("SparseSetStorage tracks entities through their component counts.", "[ECS]")
+{
+	SparseSetStorage storage;
+
+	storage.insert(entity(0), Position{}, Velocity{});
+	storage.insert(entity(1), Position{});
+	REQUIRE(storage.size() == 2);
+
+	storage.removeComponent<Position>(entity(0));
+	REQUIRE(storage.contains(entity(0)));
+	REQUIRE_FALSE(storage.has<Position>(entity(0)));
+
+	storage.removeComponent<Velocity>(entity(0));
+	REQUIRE_FALSE(storage.contains(entity(0)));
+	REQUIRE(storage.size() == 1);
+
+	storage.remove(entity(1));
+	REQUIRE(storage.size() == 0);
+	REQUIRE(storage.getPool<Position>().size() == 0);
+}
+
+TEST_CASE("SparseSetStorage::forEach() visits only entities having all requested components.", "[ECS]")
+{
+	SparseSetStorage storage;
+
+	for (EntityId::Index index = 0; index < 10; ++index)
+	{
+		storage.add<Position>(entity(index), static_cast<int>(index), 0);
+
+		if (index % 2 == 0)
+			storage.add<Velocity>(entity(index), 1, 1);
+	}
+
+	std::vector<EntityId> visited;
+	storage.forEach<Position, Velocity>([ &visited ] ( const EntityId id, Position& position, Velocity& velocity ) {
+		position.x += velocity.dx;
+		visited.emplace_back(id);
+	});
+
+	std::sort(std::begin(visited), std::end(visited));
+	REQUIRE(visited == std::vector<EntityId>{ entity(0), entity(2), entity(4), entity(6), entity(8) });
+	REQUIRE(storage.get<Position>(entity(2)).x == 3);
+	REQUIRE(storage.get<Position>(entity(3)).x == 3);
+}
+
+TEST_CASE("ComponentPool keeps its change log bounded by pool size, however often components change.", "[ECS]")
+{
+	ChangeTick tick = 1;
+	ComponentPool<Position> pool(&tick);
+
+	for (EntityId::Index index = 0; index < 100; ++index)
+		pool.emplace(entity(index));
+
+	for (int frame = 0; frame < 1000; ++frame)
+	{
+		++tick;
+		for (EntityId::Index index = 0; index < 100; index += 7)
+			pool.markChanged(entity(index));
+	}
+
+	const auto countChanged = [ &pool ] ( const ChangeTick since ) {
+		std::size_t visited = 0;
+		pool.forEachChanged(since, [ &visited ] ( EntityId ) { ++visited; });
+
+		return visited;
+	};
+
+	REQUIRE(countChanged(0) == 100);
+	REQUIRE(countChanged(1) == 15);
+	REQUIRE(pool.getChangedTick(entity(7)) == tick);
+	REQUIRE(pool.getAddedTick(entity(7)) == 1);
+	REQUIRE(pool.getChangedTick(entity(8)) == 1);
+	REQUIRE(pool.getChangedTick(entity(500)) == ComponentPool<Position>::noTick);
+}
+
+TEST_CASE("ComponentPool reports component removed and added back within a tick once.", "[ECS]")
+{
+	ChangeTick tick = 1;
+	ComponentPool<Position> pool(&tick);
+
+	for (EntityId::Index index = 0; index < 10; ++index)
+		pool.emplace(entity(index));
+
+	for (int repetition = 0; repetition < 1000; ++repetition)
+	{
+		pool.remove(entity(3));
+		pool.emplace(entity(3));
+	}
+
+	std::vector<EntityId> added;
+	pool.forEachAdded(0, [ &added ] ( const EntityId id ) { added.emplace_back(id); });
+	std::sort(std::begin(added), std::end(added));
+
+	REQUIRE(added.size() == 10);
+	REQUIRE(std::unique(std::begin(added), std::end(added)) == std::end(added));
+
+	// Same for the change log.
+	std::size_t changed = 0;
+	pool.forEachChanged(0, [ &changed ] ( EntityId ) { ++changed; });
+	REQUIRE(changed == 10);
+}
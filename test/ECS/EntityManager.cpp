@@ -1,6 +1,8 @@
 #include "GameLibrary/ECS/EntityManager.h"
 
+#include <memory>
 #include <set>
+#include <type_traits>
 
 #include "catch2/catch.hpp"
 
@@ -54,3 +56,74 @@ TEST_CASE("EntityManager reports existence of entities' components.")
 	REQUIRE_FALSE((mgr.entityHasComponent<PositionComponent>(id) || mgr.entityHasComponent<HealthComponent>(id)));
 }
 
+
+TEST_CASE("EntityManager stores plain aggregate and move-only components by value, with every storage backend.")
+{
+	struct Position {
+		float x; float y;
+	};
+	struct Owner {
+		std::unique_ptr<int> resource;
+	};
+
+	// Aggregates are initialized memberwise, and need no base class.
+	static_assert(std::is_aggregate_v<Position> && !std::is_polymorphic_v<Position>);
+
+	const auto check = [ ] ( auto& mgr ) {
+		const auto id = mgr.createEntity();
+
+		mgr.template addComponent<Position>(id, 1.f, 2.f);
+		mgr.template addComponent<Owner>(id, std::make_unique<int>(7));
+
+		const auto other = mgr.createEntity();
+		mgr.template addComponent<Position>(other, 3.f, 4.f);
+		mgr.removeEntity(other);
+
+		REQUIRE(mgr.template getComponent<Position>(id).y == 2.f);
+		REQUIRE(*mgr.template getComponent<Owner>(id).resource == 7);
+	};
+
+	EntityManager sparseSetMgr;
+	MapEntityManager mapMgr;
+	ArchetypeEntityManager archetypeMgr;
+
+	check(sparseSetMgr);
+	check(mapMgr);
+	check(archetypeMgr);
+}
+
+TEST_CASE("EntityManager::addEntities() creates a batch of entities from a prototype or a generator, with every storage backend.")
+{
+	struct Position {
+		int x; int y;
+	};
+	struct Health {
+		int health;
+	};
+	struct Particle : BaseEntity<Position, Health> {};
+
+	const auto check = [ ] ( auto& mgr ) {
+		const auto fromPrototype = mgr.template addEntities<Particle>(100, Particle::ComponentsTuple{ { 1, 2 }, { 50 } });
+		const auto fromGenerator = mgr.template addEntities<Particle>(100, [ ] ( const std::size_t i ) {
+			return Particle::ComponentsTuple{ { static_cast<int>(i), 0 }, { 100 } };
+		});
+		const auto defaulted = mgr.template addEntities<Particle>(10);
+
+		REQUIRE(mgr.getCount() == 210);
+		REQUIRE((fromPrototype.size() == 100 && fromGenerator.size() == 100 && defaulted.size() == 10));
+
+		for (const auto id : fromPrototype)
+			REQUIRE((mgr.template getComponent<Position>(id).y == 2 && mgr.template getComponent<Health>(id).health == 50));
+		for (std::size_t i = 0; i < fromGenerator.size(); ++i)
+			REQUIRE(mgr.template getComponent<Position>(fromGenerator[i]).x == static_cast<int>(i));
+		REQUIRE(mgr.template entityHasComponent<Health>(defaulted.back()));
+	};
+
+	EntityManager sparseSetMgr;
+	MapEntityManager mapMgr;
+	ArchetypeEntityManager archetypeMgr;
+
+	check(sparseSetMgr);
+	check(mapMgr);
+	check(archetypeMgr);
+}
@@ -0,0 +1,127 @@
+#include "GameLibrary/ECS/EntityTable.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "catch2/catch.hpp"
+
+#include "GameLibrary/ECS/EntityManager.h"
+
+using namespace GameLibrary::ECS;
+
+
+TEST_CASE("EntityTable reuses freed slots under a new generation, and detects stale handles.", "[ECS]")
+{
+	EntityTable table;
+
+	const auto first = table.create();
+	const auto second = table.create();
+	REQUIRE(first.getIndex() != second.getIndex());
+	REQUIRE((table.isAlive(first) && table.isAlive(second)));
+
+	table.destroy(first);
+	REQUIRE_FALSE(table.isAlive(first));
+
+	const auto reused = table.create();
+	REQUIRE(reused.getIndex() == first.getIndex());
+	REQUIRE(reused.getGeneration() == first.getGeneration() + 1);
+	REQUIRE(table.isAlive(reused));
+	REQUIRE_FALSE(table.isAlive(first));
+
+	// Destroying through a stale handle doesn't affect the entity now occupying the slot.
+	table.destroy(first);
+	REQUIRE(table.isAlive(reused));
+	REQUIRE(table.getCapacity() == 2);
+
+	REQUIRE_FALSE(table.isAlive(EntityId()));
+}
+
+TEST_CASE("EntityTable::create(count) reuses free slots first, then appends new ones.", "[ECS]")
+{
+	EntityTable table;
+
+	const auto first = table.create(10);
+	table.destroy(first[3]);
+	table.destroy(first[7]);
+
+	const auto second = table.create(5);
+	REQUIRE(second.size() == 5);
+	REQUIRE(table.getCapacity() == 13);
+	REQUIRE(table.getAliveCount() == 13);
+	REQUIRE(std::all_of(std::cbegin(second), std::cend(second), [ &table ] ( const EntityId id ) { return table.isAlive(id); }));
+}
+
+TEST_CASE("EntityManager ignores stale handles after their slot is reused.", "[ECS]")
+{
+	struct Health {
+		int value = 100;
+	};
+
+	EntityManager mgr;
+
+	const auto stale = mgr.createEntity();
+	mgr.addComponent<Health>(stale, 10);
+	mgr.removeEntity(stale);
+
+	const auto current = mgr.createEntity();
+	mgr.addComponent<Health>(current, 20);
+	REQUIRE(current.getIndex() == stale.getIndex());
+
+	REQUIRE_FALSE(mgr.entityExists(stale));
+	REQUIRE_FALSE(mgr.entityHasComponent<Health>(stale));
+	REQUIRE_THROWS(mgr.addComponent<Health>(stale));
+
+	mgr.removeEntity(stale);
+	REQUIRE(mgr.entityExists(current));
+	REQUIRE(mgr.getComponent<Health>(current).value == 20);
+}
+
+TEST_CASE("EntityManager counts and iterates live entities, including ones without components.", "[ECS]")
+{
+	struct Tag {};
+
+	EntityManager mgr;
+	std::vector<EntityManager::Id> ids;
+
+	for (int i = 0; i < 10; ++i)
+		ids.emplace_back(mgr.createEntity());
+
+	mgr.addComponent<Tag>(ids[0]);
+	REQUIRE(mgr.getCount() == 10);
+
+	mgr.removeEntity(ids[0]);
+	mgr.removeEntity(ids[5]);
+	mgr.removeEntity(ids[5]);
+	REQUIRE(mgr.getCount() == 8);
+
+	std::vector<EntityManager::Id> visited;
+	mgr.forEachEntity([ &visited ] ( const EntityManager::Id id ) { visited.emplace_back(id); });
+
+	std::sort(std::begin(visited), std::end(visited));
+	ids.erase(std::begin(ids) + 5);
+	ids.erase(std::begin(ids));
+
+	REQUIRE(visited == ids);
+	REQUIRE(mgr.getEntities().size() == 8);
+}
+
+TEST_CASE("EntityTable restores slots read from another table.", "[ECS]")
+{
+	EntityTable table;
+	const auto ids = table.create(4);
+	table.destroy(ids[1]);
+	table.destroy(ids[3]);
+
+	EntityTable restored;
+	restored.restore(table.getGenerations(), table.getFreeIndices());
+
+	REQUIRE(restored.getAliveCount() == 2);
+	REQUIRE((restored.isAlive(ids[0]) && restored.isAlive(ids[2])));
+	REQUIRE_FALSE(restored.isAlive(ids[1]));
+	REQUIRE(restored.create() == table.create());
+	REQUIRE(restored.create() == table.create());
+
+	REQUIRE_THROWS_AS(restored.restore({ 0, 0 }, { 1, 1 }), GameLibrary::Exceptions::InvalidArgument);
+	REQUIRE_THROWS_AS(restored.restore({ 0, 0 }, { 2 }), GameLibrary::Exceptions::InvalidArgument);
+	REQUIRE(restored.getAliveCount() == 4);
+}
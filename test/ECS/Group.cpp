@@ -0,0 +1,139 @@
+#include "GameLibrary/ECS/Group.h"
+
+#include <algorithm>
+#include <atomic>
+#include <vector>
+
+#include "catch2/catch.hpp"
+
+#include "GameLibrary/ECS/EntityManager.h"
+#include "GameLibrary/Exceptions/Standard.h"
+#include "GameLibrary/Utilities/ThreadPool.h"
+
+using namespace GameLibrary;
+using namespace GameLibrary::ECS;
+
+
+namespace
+{
+	struct Position {
+		int x = 0; int y = 0;
+	};
+	struct Velocity {
+		int dx = 0; int dy = 0;
+	};
+	struct Mass {
+		int value = 1;
+	};
+
+	// Every grouped entity must sit at the same leading position of all owned pools.
+	template<typename G>
+	void requireArranged(EntityManager& mgr, const G& group) {
+		const auto& positions = mgr.getComponents<Position>().getEntities();
+		const auto& velocities = mgr.getComponents<Velocity>().getEntities();
+
+		std::size_t expected = 0;
+		mgr.forEach<Position, Velocity>([ &expected ] ( const Position&, const Velocity& ) { ++expected; });
+
+		REQUIRE(group.size() == expected);
+		for (std::size_t i = 0; i < group.size(); ++i)
+		{
+			REQUIRE(positions[i] == velocities[i]);
+			REQUIRE(mgr.getComponent<Position>(positions[i]).x == mgr.getComponent<Velocity>(positions[i]).dx);
+		}
+	}
+}
+
+
+TEST_CASE("Group keeps owned pools arranged as components and entities come and go.", "[ECS]")
+{
+	EntityManager mgr;
+	std::vector<EntityId> ids;
+
+	// Entities existing before group is created are arranged on creation.
+	for (int i = 0; i < 100; ++i)
+	{
+		const auto id = mgr.createEntity();
+		ids.emplace_back(id);
+
+		if (i % 2 == 0)
+			mgr.addComponent<Position>(id, i, 0);
+		if (i % 3 == 0)
+			mgr.addComponent<Velocity>(id, i, 0);
+	}
+
+	const auto group = mgr.group<Position, Velocity>();
+	requireArranged(mgr, group);
+	REQUIRE(group.size() == 17);
+
+	for (int i = 0; i < 100; ++i)
+	{
+		if (i % 2 != 0)
+			mgr.addComponent<Position>(ids[i], i, 0);
+		if (i % 5 == 0)
+			mgr.removeComponent<Velocity>(ids[i]);
+	}
+	requireArranged(mgr, group);
+
+	for (int i = 0; i < 100; i += 7)
+		mgr.removeEntity(ids[i]);
+	requireArranged(mgr, group);
+
+	REQUIRE(group.contains(ids[3]));
+	REQUIRE_FALSE(group.contains(ids[0]));
+	REQUIRE_FALSE(group.contains(ids[5]));
+
+	// Same group is returned on further calls.
+	REQUIRE(mgr.group<Position, Velocity>().size() == group.size());
+}
+
+TEST_CASE("Group iterates owned components as parallel arrays.", "[ECS]")
+{
+	EntityManager mgr;
+	Utilities::ThreadPool threadPool(2);
+
+	for (int i = 0; i < 1000; ++i)
+	{
+		const auto id = mgr.createEntity();
+		mgr.addComponent<Position>(id, 0, 0);
+		if (i % 4 != 0)
+		{
+			mgr.addComponent<Velocity>(id, 1, 2);
+			mgr.addComponent<Mass>(id, i);
+		}
+	}
+
+	const auto group = mgr.group<Position, Velocity, Mass>();
+	REQUIRE(group.size() == 750);
+
+	group.forEach([ ] ( Position& position, const Velocity& velocity, const Mass& ) {
+		position.x += velocity.dx;
+		position.y += velocity.dy;
+	});
+	group.parallelForEach(threadPool, [ ] ( Position& position, const Velocity& velocity, const Mass& ) {
+		position.x += velocity.dx;
+	});
+
+	std::atomic<int> visited{0};
+	group.parallelForEach(threadPool, [ &visited ] ( const EntityId, const Position& position, const Velocity&, const Mass& mass ) {
+		if (position.x == 2 && position.y == 2 && mass.value % 4 != 0)
+			++visited;
+	});
+	REQUIRE(visited == 750);
+
+	// Views over owned pools still work.
+	int moved = 0;
+	mgr.forEach<Position>([ &moved ] ( const Position& position ) { moved += (position.x == 2); });
+	REQUIRE(moved == 750);
+}
+
+TEST_CASE("Pool can be owned by a single group.", "[ECS]")
+{
+	EntityManager mgr;
+
+	mgr.group<Position, Velocity>();
+
+	REQUIRE_THROWS_AS((mgr.group<Position, Mass>()), Exceptions::InvalidArgument);
+	REQUIRE_THROWS_AS((mgr.group<Velocity, Position>()), Exceptions::InvalidArgument);
+	REQUIRE_NOTHROW(mgr.group<Mass>());
+}
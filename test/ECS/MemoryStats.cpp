@@ -0,0 +1,119 @@
+#include "GameLibrary/ECS/MemoryStats.h"
+
+#include <algorithm>
+#include <sstream>
+#include <string>
+
+#include "catch2/catch.hpp"
+
+#include "GameLibrary/Console/Console.h"
+#include "GameLibrary/ECS/EntityManager.h"
+#include "GameLibrary/ECS/MemoryStatsCommand.h"
+
+using namespace GameLibrary::ECS;
+
+
+namespace
+{
+	struct Health {
+		int value;
+	};
+
+	struct Armor {
+		double value;
+	};
+
+	struct Frozen {};
+
+	const MemoryUsage& findUsage(const MemoryStats& stats, const std::string& name) {
+		const auto usage = std::find_if(std::cbegin(stats.components), std::cend(stats.components), [ &name ] ( const MemoryUsage& u ) {
+			return u.name == name;
+		});
+		REQUIRE(usage != std::cend(stats.components));
+
+		return *usage;
+	}
+}
+
+TEST_CASE("EntityManager::getMemoryStats() reports counts and bytes of entity table and every component pool.", "[ECS]")
+{
+	EntityManager mgr;
+
+	std::vector<EntityId> ids;
+	for (int i = 0; i < 100; ++i)
+	{
+		ids.emplace_back(mgr.createEntity());
+		mgr.addComponent<Health>(ids.back(), i);
+		if (i % 2 == 0)
+			mgr.addComponent<Armor>(ids.back(), 1.0);
+		if (i % 4 == 0)
+			mgr.addComponent<Frozen>(ids.back());
+	}
+
+	auto stats = mgr.getMemoryStats();
+
+	REQUIRE(stats.entities.count == 100);
+	REQUIRE(stats.entitySlots == 100);
+	REQUIRE(stats.freeEntitySlots == 0);
+	REQUIRE(stats.storage.count == 100);
+
+	const auto& health = findUsage(stats, componentName<Health>());
+	REQUIRE(health.count == 100);
+	REQUIRE(health.bytesUsed >= 100 * (sizeof(Health) + sizeof(EntityId)));
+	REQUIRE(health.bytesReserved >= health.bytesUsed);
+
+	const auto& armor = findUsage(stats, componentName<Armor>());
+	REQUIRE(armor.count == 50);
+	REQUIRE(armor.bytesUsed >= 50 * (sizeof(Armor) + sizeof(EntityId)));
+
+	REQUIRE(findUsage(stats, componentName<Frozen>()).count == 25);
+
+	REQUIRE(stats.getBytesUsed() <= stats.getBytesReserved());
+
+	SECTION("Capacity kept after removals shows up as fragmentation, and freed slots as free entity slots.")
+	{
+		const auto usedBefore = findUsage(stats, componentName<Health>()).bytesUsed;
+		const auto reservedBefore = findUsage(stats, componentName<Health>()).bytesReserved;
+		const auto fragmentationBefore = findUsage(stats, componentName<Health>()).getFragmentation();
+
+		for (std::size_t i = 0; i < 90; ++i)
+			mgr.removeEntity(ids[i]);
+
+		stats = mgr.getMemoryStats();
+		const auto& shrunk = findUsage(stats, componentName<Health>());
+
+		REQUIRE(stats.entities.count == 10);
+		REQUIRE(stats.entitySlots == 100);
+		REQUIRE(stats.freeEntitySlots == 90);
+		REQUIRE(shrunk.count == 10);
+		REQUIRE(shrunk.bytesUsed < usedBefore);
+		REQUIRE(shrunk.bytesReserved == reservedBefore);
+		REQUIRE(shrunk.getFragmentation() > fragmentationBefore);
+	}
+}
+
+TEST_CASE("MemoryUsage::getFragmentation() reports share of reserved bytes not in use.", "[ECS]")
+{
+	REQUIRE(MemoryUsage{}.getFragmentation() == 0.0);
+	REQUIRE(MemoryUsage{ "packed", 1, 64, 64 }.getFragmentation() == 0.0);
+	REQUIRE(MemoryUsage{ "quarter", 1, 16, 64 }.getFragmentation() == Approx(0.75));
+}
+
+TEST_CASE("MemoryStatsCommand prints memory stats of an EntityManager when its command is sent.", "[ECS]")
+{
+	EntityManager mgr;
+	mgr.addComponent<Health>(mgr.createEntity(), 10);
+
+	GameLibrary::Console::Console console;
+	std::ostringstream out;
+
+	console.initCommandInfos<MemoryStatsCommand>();
+	console.addObject<MemoryStatsCommand>(mgr, out);
+
+	console.parse("ecs_memory");
+
+	const auto printed = out.str();
+	REQUIRE(printed.find("Entities: 1 alive, 1 slots, 0 free") != std::string::npos);
+	REQUIRE(printed.find(componentName<Health>()) != std::string::npos);
+	REQUIRE(printed.find("Total") != std::string::npos);
+}
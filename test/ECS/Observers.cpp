@@ -0,0 +1,117 @@
+#include "GameLibrary/ECS/Observers.h"
+
+#include <vector>
+
+#include "catch2/catch.hpp"
+
+#include "GameLibrary/ECS/Entity.h"
+#include "GameLibrary/ECS/EntityManager.h"
+#include "GameLibrary/ECS/Events.h"
+#include "GameLibrary/Event/Dispatcher.h"
+
+using namespace GameLibrary;
+using namespace GameLibrary::ECS;
+
+
+namespace
+{
+	struct Collider {
+		int radius = 1;
+	};
+	struct Unobserved {};
+
+	struct Body : BaseEntity<Collider, Unobserved> {};
+}
+
+
+TEST_CASE("EntityManager collects lifecycle changes of observed components, and dispatches them in batches.", "[ECS]")
+{
+	EntityManager mgr;
+	Event::Dispatcher dispatcher;
+
+	std::vector<std::vector<EntityId>> added;
+	std::vector<std::vector<EntityId>> replaced;
+	std::vector<std::vector<EntityId>> removed;
+	int unobservedEvents = 0;
+
+	dispatcher.addCallback<ComponentsAddedEvent<Collider>>([ &added ] ( const ComponentsAddedEvent<Collider>& e ) { added.emplace_back(e.entities); });
+	dispatcher.addCallback<ComponentsReplacedEvent<Collider>>([ &replaced ] ( const ComponentsReplacedEvent<Collider>& e ) { replaced.emplace_back(e.entities); });
+	dispatcher.addCallback<ComponentsRemovedEvent<Collider>>([ &removed ] ( const ComponentsRemovedEvent<Collider>& e ) { removed.emplace_back(e.entities); });
+	dispatcher.addCallback<ComponentsAddedEvent<Unobserved>>([ &unobservedEvents ] { ++unobservedEvents; });
+
+	mgr.observe<Collider>();
+
+	const auto batch = mgr.addEntities<Body>(1000);
+	const auto single = mgr.addEntity<Body>();
+	const auto manual = mgr.createEntity();
+	mgr.addComponent<Collider>(manual);
+	// Adding a component entity already has adds nothing.
+	mgr.addComponent<Collider>(manual);
+
+	// Nothing is delivered before flush.
+	REQUIRE(added.empty());
+	mgr.flushObservers(dispatcher);
+
+	REQUIRE(added.size() == 1);
+	REQUIRE(added[0].size() == 1002);
+	REQUIRE(added[0][1000] == single);
+	REQUIRE(unobservedEvents == 0);
+
+	mgr.replaceComponent<Collider>(single, 5);
+	mgr.removeComponent<Collider>(manual);
+	mgr.removeComponent<Collider>(manual);
+	mgr.removeEntity(batch[0]);
+	mgr.removeEntity(manual);
+	mgr.flushObservers(dispatcher);
+
+	REQUIRE(added.size() == 1);
+	REQUIRE(replaced == std::vector<std::vector<EntityId>>{ { single } });
+	REQUIRE(removed == std::vector<std::vector<EntityId>>{ { manual, batch[0] } });
+	REQUIRE(mgr.getComponent<Collider>(single).radius == 5);
+
+	// Flushing without changes dispatches nothing.
+	mgr.flushObservers(dispatcher);
+	REQUIRE(removed.size() == 1);
+}
+
+TEST_CASE("EntityManager delivers observed changes made by flush callbacks on the next flush.", "[ECS]")
+{
+	EntityManager mgr;
+	Event::Dispatcher dispatcher;
+
+	std::vector<std::vector<EntityId>> added;
+	std::vector<EntityId> spawned;
+
+	// First batch spawns as many new colliders while it's being dispatched.
+	dispatcher.addCallback<ComponentsAddedEvent<Collider>>([ &mgr, &added, &spawned ] ( const ComponentsAddedEvent<Collider>& e ) {
+		added.emplace_back(e.entities);
+
+		if (added.size() > 1)
+			return;
+
+		for (std::size_t i = 0; i < e.entities.size(); ++i)
+		{
+			spawned.emplace_back(mgr.createEntity());
+			mgr.addComponent<Collider>(spawned.back());
+		}
+	});
+
+	mgr.observe<Collider>();
+
+	std::vector<EntityId> initial;
+	for (int i = 0; i < 100; ++i)
+	{
+		initial.emplace_back(mgr.createEntity());
+		mgr.addComponent<Collider>(initial.back());
+	}
+
+	mgr.flushObservers(dispatcher);
+
+	REQUIRE(added == std::vector<std::vector<EntityId>>{ initial });
+	REQUIRE(spawned.size() == 100);
+
+	mgr.flushObservers(dispatcher);
+
+	REQUIRE(added.size() == 2);
+	REQUIRE(added[1] == spawned);
+}
@@ -0,0 +1,84 @@
+#include "GameLibrary/ECS/Prefab.h"
+
+#include <istream>
+#include <sstream>
+#include <string>
+
+#include "catch2/catch.hpp"
+
+#include "GameLibrary/ECS/EntityManager.h"
+#include "GameLibrary/ECS/StaticWorld.h"
+#include "GameLibrary/Exceptions/Standard.h"
+
+using namespace GameLibrary;
+using namespace GameLibrary::ECS;
+
+
+namespace
+{
+	struct Position {
+		int x = 0; int y = 0;
+	};
+	struct Health {
+		int health = 100;
+	};
+	struct Name {
+		std::string value;
+	};
+
+	std::istream& operator>>(std::istream& stream, Position& position) {
+		return stream >> position.x >> position.y;
+	}
+
+	std::istream& operator>>(std::istream& stream, Health& health) {
+		return stream >> health.health;
+	}
+
+	std::istream& operator>>(std::istream& stream, Name& name) {
+		return stream >> name.value;
+	}
+
+	using Bullet = Prefab<Position, Health, Name>;
+}
+
+
+TEST_CASE("Prefab instantiates entities with copies of its components.", "[ECS]")
+{
+	EntityManager mgr;
+	Bullet bullet({ 1, 2 }, { 5 }, { "bullet" });
+
+	const auto single = bullet.instantiate(mgr);
+	const auto batch = bullet.instantiate(mgr, 100);
+
+	// Changing prefab affects only entities instantiated afterwards.
+	bullet.get<Health>().health = 10;
+	const auto later = bullet.instantiate(mgr);
+
+	REQUIRE(mgr.getCount() == 102);
+	REQUIRE(mgr.getComponent<Name>(single).value == "bullet");
+	REQUIRE(mgr.getComponent<Health>(batch.back()).health == 5);
+	REQUIRE(mgr.getComponent<Health>(later).health == 10);
+
+	mgr.getComponent<Position>(batch.front()).x = 50;
+	REQUIRE(mgr.getComponent<Position>(batch.back()).x == 1);
+	REQUIRE(bullet.get<Position>().x == 1);
+
+	StaticWorld<Position, Health, Name> world;
+	REQUIRE(world.getComponent<Name>(bullet.instantiate(world)).value == "bullet");
+}
+
+TEST_CASE("Prefab is loaded from a stream using operator>> of its components.", "[ECS]")
+{
+	Bullet bullet;
+
+	std::istringstream data("3 4 25 rocket");
+	data >> bullet;
+
+	REQUIRE(bullet.get<Position>().y == 4);
+	REQUIRE(bullet.get<Health>().health == 25);
+	REQUIRE(bullet.get<Name>().value == "rocket");
+
+	std::istringstream invalid("3 x");
+	REQUIRE_THROWS_AS(invalid >> bullet, Exceptions::InvalidArgument);
+	REQUIRE(bullet.get<Position>().x == 3);
+}
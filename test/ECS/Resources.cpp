@@ -0,0 +1,93 @@
+#include "GameLibrary/ECS/Resources.h"
+
+#include <memory>
+#include <vector>
+
+#include "catch2/catch.hpp"
+
+#include "GameLibrary/ECS/EntityManager.h"
+#include "GameLibrary/ECS/Scheduler.h"
+#include "GameLibrary/Exceptions/Standard.h"
+
+using namespace GameLibrary;
+using namespace GameLibrary::ECS;
+
+
+namespace
+{
+	struct TimeStep {
+		float seconds = 1.f / 60.f;
+	};
+	struct Camera {
+		float x = 0.f; float y = 0.f;
+	};
+	struct Position {
+		float x = 0.f; float y = 0.f;
+	};
+}
+
+
+TEST_CASE("Resources hold one value per type, at a stable address.", "[ECS]")
+{
+	Resources resources;
+	REQUIRE_FALSE(resources.contains<TimeStep>());
+	REQUIRE(resources.find<TimeStep>() == nullptr);
+	REQUIRE_THROWS_AS(resources.get<TimeStep>(), Exceptions::NotFoundError);
+
+	auto& step = resources.emplace<TimeStep>(0.5f);
+	auto& camera = resources.emplace<Camera>();
+	REQUIRE(&resources.get<TimeStep>() == &step);
+	REQUIRE(resources.get<TimeStep>().seconds == 0.5f);
+	REQUIRE(&resources.get<Camera>() == &camera);
+
+	camera.x = 10.f;
+	REQUIRE(static_cast<const Resources&>(resources).get<Camera>().x == 10.f);
+
+	resources.emplace<TimeStep>(0.25f);
+	REQUIRE(resources.get<TimeStep>().seconds == 0.25f);
+
+	resources.remove<TimeStep>();
+	REQUIRE_FALSE(resources.contains<TimeStep>());
+	REQUIRE(resources.contains<Camera>());
+
+	// Non-movable values are constructed in place.
+	resources.emplace<std::unique_ptr<int>>(std::make_unique<int>(5));
+	REQUIRE(*resources.get<std::unique_ptr<int>>() == 5);
+}
+
+TEST_CASE("EntityManager keeps world resources apart from entities.", "[ECS]")
+{
+	EntityManager mgr;
+
+	mgr.emplaceResource<TimeStep>();
+	mgr.resource<TimeStep>().seconds = 0.1f;
+
+	REQUIRE(mgr.hasResource<TimeStep>());
+	REQUIRE(mgr.findResource<TimeStep>()->seconds == 0.1f);
+	REQUIRE(mgr.getCount() == 0);
+	REQUIRE_THROWS_AS(mgr.resource<Camera>(), Exceptions::NotFoundError);
+
+	mgr.removeResource<TimeStep>();
+	REQUIRE(mgr.findResource<TimeStep>() == nullptr);
+}
+
+TEST_CASE("Scheduler orders systems by declared resource access.", "[ECS]")
+{
+	Scheduler scheduler;
+	const auto noop = [ ] {};
+
+	const auto advance = scheduler.addSystem("advance", Reads<>(), Writes<Resource<TimeStep>>(), noop);
+	const auto moveA = scheduler.addSystem("moveA", Reads<Resource<TimeStep>>(), Writes<Position>(), noop);
+	const auto follow = scheduler.addSystem("follow", Reads<Position>(), Writes<Resource<Camera>>(), noop);
+	const auto render = scheduler.addSystem("render", Reads<Resource<Camera>, Resource<TimeStep>>(), Writes<>(), noop);
+
+	REQUIRE(scheduler.getDependencies(moveA) == std::vector<Scheduler::SystemId>{ advance });
+	REQUIRE(scheduler.getDependencies(follow) == std::vector<Scheduler::SystemId>{ moveA });
+	REQUIRE(scheduler.getDependencies(render) == std::vector<Scheduler::SystemId>{ advance, follow });
+
+	// Resource markers don't clash with the component of the same type.
+	const auto readsPosition = scheduler.addSystem("readsPosition", Reads<Position>(), Writes<>(), noop);
+	const auto writesPositionResource = scheduler.addSystem("writesPositionResource", Reads<>(), Writes<Resource<Position>>(), noop);
+	REQUIRE(scheduler.getDependencies(writesPositionResource).empty());
+	REQUIRE(scheduler.getDependencies(readsPosition) == std::vector<Scheduler::SystemId>{ moveA });
+}
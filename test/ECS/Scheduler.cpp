@@ -0,0 +1,179 @@
+#include "GameLibrary/ECS/Scheduler.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "catch2/catch.hpp"
+
+#include "GameLibrary/ECS/EntityManager.h"
+#include "GameLibrary/Utilities/ThreadPool.h"
+
+using namespace GameLibrary;
+using namespace GameLibrary::ECS;
+
+
+namespace
+{
+	struct Position {};
+	struct Velocity {};
+	struct Health {};
+}
+
+
+TEST_CASE("Scheduler makes systems depend on earlier systems with conflicting component access.", "[ECS]")
+{
+	Scheduler scheduler;
+	const auto noop = [ ] { };
+
+	const auto movement = scheduler.addSystem("movement", Reads<Velocity>(), Writes<Position>(), noop);
+	const auto render = scheduler.addSystem("render", Reads<Position>(), Writes<>(), noop);
+	const auto regen = scheduler.addSystem("regen", Reads<>(), Writes<Health>(), noop);
+	const auto readers = scheduler.addSystem("readers", Reads<Velocity, Health>(), Writes<>(), noop);
+	const auto drag = scheduler.addSystem("drag", Reads<>(), Writes<Velocity>(), noop);
+
+	REQUIRE(scheduler.getDependencies(movement).empty());
+	REQUIRE(scheduler.getDependencies(render) == std::vector<Scheduler::SystemId>{ movement });
+	REQUIRE(scheduler.getDependencies(regen).empty());
+	// Readers of the same component don't conflict.
+	REQUIRE(scheduler.getDependencies(readers) == std::vector<Scheduler::SystemId>{ regen });
+	REQUIRE(scheduler.getDependencies(drag) == std::vector<Scheduler::SystemId>{ movement, readers });
+}
+
+TEST_CASE("Scheduler runs systems on ThreadPool, never before their dependencies finish.", "[ECS]")
+{
+	Scheduler scheduler;
+	Utilities::ThreadPool threadPool(4);
+
+	std::mutex mutex;
+	std::vector<std::string> order;
+	const auto record = [ &mutex, &order ] ( const std::string& name ) {
+		return [ &mutex, &order, name ] {
+			std::this_thread::sleep_for(std::chrono::milliseconds(2));
+
+			std::lock_guard lock(mutex);
+			order.emplace_back(name);
+		};
+	};
+
+	scheduler.addSystem("a", Reads<>(), Writes<Position>(), record("a"));
+	scheduler.addSystem("b", Reads<>(), Writes<Health>(), record("b"));
+	scheduler.addSystem("c", Reads<Position>(), Writes<Velocity>(), record("c"));
+	scheduler.addSystem("d", Reads<Velocity, Health>(), Writes<>(), record("d"));
+
+	for (int frame = 0; frame < 20; ++frame)
+	{
+		order.clear();
+		scheduler.run(threadPool);
+
+		REQUIRE(order.size() == 4);
+		const auto position = [ &order ] ( const std::string& name ) { return std::find(std::cbegin(order), std::cend(order), name); };
+		REQUIRE(position("a") < position("c"));
+		REQUIRE(position("c") < position("d"));
+		REQUIRE(position("b") < position("d"));
+	}
+
+	const auto path = scheduler.getCriticalPath();
+	REQUIRE(path == std::vector<Scheduler::SystemId>{ 0, 2, 3 });
+	REQUIRE(scheduler.getCriticalPathDuration() >= std::chrono::milliseconds(6));
+	REQUIRE(scheduler.getTiming(3).start >= scheduler.getTiming(2).finish);
+}
+
+TEST_CASE("Scheduler rethrows system's exception, and skips systems depending on it.", "[ECS]")
+{
+	Scheduler scheduler;
+	Utilities::ThreadPool threadPool(2);
+	std::atomic<int> runCount = 0;
+
+	scheduler.addSystem("failing", Reads<>(), Writes<Position>(), [ ] { throw std::runtime_error("failed"); });
+	scheduler.addSystem("dependent", Reads<Position>(), Writes<>(), [ &runCount ] { ++runCount; });
+	scheduler.addSystem("independent", Reads<Health>(), Writes<>(), [ &runCount ] { ++runCount; });
+
+	REQUIRE_THROWS_AS(scheduler.run(threadPool), std::runtime_error);
+	REQUIRE(runCount == 1);
+}
+
+TEST_CASE("Scheduler runs systems reading components through a const EntityManager concurrently, without stamping changes.", "[ECS]")
+{
+	struct Stamina {
+		int value = 0;
+	};
+
+	EntityManager mgr;
+	for (int i = 0; i < 1000; ++i)
+		mgr.addComponent<Stamina>(mgr.createEntity(), 1);
+
+	const auto since = mgr.advanceChangeTick();
+	const EntityManager& reader = mgr;
+
+	Scheduler scheduler;
+	Utilities::ThreadPool threadPool(2);
+	std::atomic<int> total = 0;
+
+	const auto sumStamina = [ &reader, &total ] {
+		int sum = 0;
+		for (const auto id : reader.getEntities())
+			sum += reader.getComponent<Stamina>(id).value;
+		total += sum;
+	};
+	scheduler.addSystem("first reader", Reads<Stamina>(), Writes<>(), sumStamina);
+	scheduler.addSystem("second reader", Reads<Stamina>(), Writes<>(), sumStamina);
+
+	REQUIRE(scheduler.getDependencies(1).empty());
+
+	scheduler.run(threadPool);
+
+	REQUIRE(total == 2000);
+
+	std::size_t changed = 0;
+	mgr.view<Stamina>().changed<Stamina>(since).forEach([ &changed ] ( const Stamina& ) { ++changed; });
+	REQUIRE(changed == 0);
+}
+
+TEST_CASE("Scheduler::addSystem() with an EntityManager creates storage of declared components, so disjoint systems can view fresh types concurrently.", "[ECS]")
+{
+	struct Fuel {
+		int value = 0;
+	};
+	struct Ammo {
+		int value = 0;
+	};
+	struct Gravity {};
+
+	EntityManager mgr;
+	for (int i = 0; i < 1000; ++i)
+		mgr.createEntity();
+
+	const auto hasPool = [ &mgr ] ( const std::string& name ) {
+		const auto stats = mgr.getMemoryStats();
+		return std::any_of(std::cbegin(stats.components), std::cend(stats.components), [ &name ] ( const MemoryUsage& usage ) {
+			return usage.name == name;
+		});
+	};
+
+	Scheduler scheduler;
+	Utilities::ThreadPool threadPool(2);
+	std::atomic<int> visited = 0;
+
+	scheduler.addSystem(mgr, "fuel", Reads<Resource<Gravity>>(), Writes<Fuel>(), [ &mgr, &visited ] {
+		mgr.view<Fuel>().forEach([ &visited ] ( Fuel& ) { ++visited; });
+	});
+	scheduler.addSystem(mgr, "ammo", Reads<>(), Writes<Ammo>(), [ &mgr, &visited ] {
+		mgr.view<Ammo>().forEach([ &visited ] ( Ammo& ) { ++visited; });
+	});
+
+	REQUIRE(scheduler.getDependencies(1).empty());
+	REQUIRE(hasPool(componentName<Fuel>()));
+	REQUIRE(hasPool(componentName<Ammo>()));
+	REQUIRE_FALSE(hasPool(componentName<Resource<Gravity>>()));
+
+	for (int frame = 0; frame < 10; ++frame)
+		scheduler.run(threadPool);
+
+	REQUIRE(visited == 0);
+}
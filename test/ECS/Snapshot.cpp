@@ -0,0 +1,178 @@
+#include "GameLibrary/ECS/Snapshot.h"
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "catch2/catch.hpp"
+
+#include "GameLibrary/ECS/EntityManager.h"
+#include "GameLibrary/Exceptions/Standard.h"
+
+using namespace GameLibrary;
+using namespace GameLibrary::ECS;
+
+
+namespace
+{
+	struct Position {
+		float x = 0.f; float y = 0.f;
+	};
+	struct Health {
+		std::int32_t value = 100;
+	};
+	struct Enemy {};
+	struct Wide {
+		double x = 0.0; double y = 0.0;
+	};
+
+	struct Mover : BaseEntity<Position> {};
+	struct Foe : BaseEntity<Position, Health, Enemy> {};
+
+	using WorldSnapshot = Snapshot<Position, Health, Enemy>;
+
+	std::string snapshotPath(const std::string& name) {
+		return (std::filesystem::temp_directory_path() / ("GameLibraryTest_" + name + ".snap")).string();
+	}
+}
+
+
+TEST_CASE("Snapshot restores entities and components.", "[ECS]")
+{
+	const auto path = snapshotPath("RoundTrip");
+
+	EntityManager mgr;
+	const auto mover = mgr.addEntity<Mover>({ Position{ 1.f, 2.f } });
+	const auto foe = mgr.addEntity<Foe>({ Position{ 3.f, 4.f }, Health{ 42 }, Enemy{} });
+	const auto bare = mgr.createEntity();
+
+	WorldSnapshot::save(mgr, path);
+
+	EntityManager loaded;
+	WorldSnapshot::load(loaded, path);
+
+	REQUIRE(loaded.getCount() == 3);
+	REQUIRE(loaded.entityExists(mover));
+	REQUIRE(loaded.entityExists(bare));
+
+	REQUIRE(loaded.getComponent<Position>(mover).x == 1.f);
+	REQUIRE(loaded.getComponent<Position>(foe).y == 4.f);
+	REQUIRE(loaded.getComponent<Health>(foe).value == 42);
+	REQUIRE(loaded.entityHasComponent<Enemy>(foe));
+	REQUIRE_FALSE(loaded.entityHasComponent<Enemy>(mover));
+	REQUIRE_FALSE(loaded.entityHasComponent<Position>(bare));
+
+	std::size_t visited = 0;
+	loaded.view<Position, Health>().forEach([ & ] ( const EntityId id, Position&, Health& ) {
+		REQUIRE(id == foe);
+		++visited;
+	});
+	REQUIRE(visited == 1);
+
+	// Loaded components behave as any others.
+	loaded.removeComponent<Position>(foe);
+	REQUIRE(loaded.getStorage().getPool<Position>().size() == 1);
+
+	std::filesystem::remove(path);
+}
+
+TEST_CASE("Snapshot keeps stale handles stale, and reuses freed slots in the same order.", "[ECS]")
+{
+	const auto path = snapshotPath("Generations");
+
+	EntityManager mgr;
+	const auto first = mgr.addEntity<Mover>();
+	const auto second = mgr.addEntity<Mover>();
+	mgr.addEntity<Mover>();
+	mgr.removeEntity(first);
+	mgr.removeEntity(second);
+
+	WorldSnapshot::save(mgr, path);
+
+	EntityManager loaded;
+	WorldSnapshot::load(loaded, path);
+
+	REQUIRE_FALSE(loaded.entityExists(first));
+	REQUIRE_FALSE(loaded.entityExists(second));
+	REQUIRE(loaded.createEntity() == mgr.createEntity());
+	REQUIRE(loaded.createEntity() == mgr.createEntity());
+	REQUIRE(loaded.createEntity() == mgr.createEntity());
+
+	std::filesystem::remove(path);
+}
+
+TEST_CASE("Snapshot refuses files of different component types, damaged files and non-empty managers.", "[ECS]")
+{
+	const auto path = snapshotPath("Errors");
+
+	EntityManager mgr;
+	mgr.addEntity<Foe>();
+	mgr.addEntity<Mover>();
+	WorldSnapshot::save(mgr, path);
+
+	SECTION("Different component list")
+	{
+		EntityManager loaded;
+		REQUIRE_THROWS_AS((Snapshot<Position, Health>::load(loaded, path)), Exceptions::FormatError);
+	}
+
+	SECTION("Different component layout")
+	{
+		EntityManager loaded;
+		REQUIRE_THROWS_AS((Snapshot<Wide, Health, Enemy>::load(loaded, path)), Exceptions::FormatError);
+	}
+
+	SECTION("Truncated file")
+	{
+		const auto size = std::filesystem::file_size(path);
+		std::filesystem::resize_file(path, size - 8);
+
+		EntityManager loaded;
+		REQUIRE_THROWS_AS(WorldSnapshot::load(loaded, path), Exceptions::FormatError);
+	}
+
+	SECTION("Forged entity counts")
+	{
+		// slotCount and freeCount follow magic, version and byte order mark in the file header.
+		const auto forge = [ &path ] ( const std::uint64_t slotCount, const std::uint64_t freeCount ) {
+			std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+			file.seekp(16);
+			file.write(reinterpret_cast<const char*>(&slotCount), sizeof(slotCount));
+			file.write(reinterpret_cast<const char*>(&freeCount), sizeof(freeCount));
+		};
+
+		// Past the largest entity index.
+		forge(std::numeric_limits<std::uint64_t>::max(), 0);
+		EntityManager first;
+		REQUIRE_THROWS_AS(WorldSnapshot::load(first, path), Exceptions::FormatError);
+
+		// Valid index range, but far more than the file holds - must fail before allocating.
+		forge(std::numeric_limits<EntityId::Index>::max(), std::numeric_limits<EntityId::Index>::max());
+		EntityManager second;
+		REQUIRE_THROWS_AS(WorldSnapshot::load(second, path), Exceptions::FormatError);
+	}
+
+	SECTION("Not a snapshot")
+	{
+		std::ofstream(path, std::ios::binary | std::ios::trunc) << "Not a snapshot at all, just some text.";
+
+		EntityManager loaded;
+		REQUIRE_THROWS_AS(WorldSnapshot::load(loaded, path), Exceptions::FormatError);
+	}
+
+	SECTION("Missing file")
+	{
+		EntityManager loaded;
+		REQUIRE_THROWS_AS(WorldSnapshot::load(loaded, snapshotPath("Missing")), Exceptions::IoError);
+	}
+
+	SECTION("Non-empty manager")
+	{
+		REQUIRE_THROWS_AS(WorldSnapshot::load(mgr, path), Exceptions::InvalidArgument);
+	}
+
+	std::filesystem::remove(path);
+}
@@ -0,0 +1,173 @@
+#include "GameLibrary/ECS/SpatialGrid.h"
+
+#include <algorithm>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "catch2/catch.hpp"
+
+#include "GameLibrary/ECS/EntityManager.h"
+#include "GameLibrary/Event/Dispatcher.h"
+#include "GameLibrary/Exceptions/Standard.h"
+
+using namespace GameLibrary;
+using namespace GameLibrary::ECS;
+
+
+namespace
+{
+	struct Position {
+		float x = 0.0f; float y = 0.0f;
+	};
+
+	using Grid = SpatialGrid<Position>;
+
+	std::vector<EntityId> sorted(std::vector<EntityId> ids) {
+		std::sort(std::begin(ids), std::end(ids));
+		return ids;
+	}
+
+	float distanceSquared(const Position& position, const Grid::Point center) {
+		return (position.x - center.x) * (position.x - center.x) + (position.y - center.y) * (position.y - center.y);
+	}
+}
+
+
+TEST_CASE("SpatialGrid answers box and radius queries same as scanning all positions.", "[ECS]")
+{
+	EntityManager mgr;
+	Grid grid(10.0f);
+	std::mt19937 random(7);
+	std::uniform_real_distribution<float> coordinate(-500.0f, 500.0f);
+
+	for (int i = 0; i < 2000; ++i)
+		mgr.addComponent<Position>(mgr.createEntity(), coordinate(random), coordinate(random));
+
+	grid.update(mgr, 0);
+	REQUIRE(grid.size() == 2000);
+
+	for (int query = 0; query < 50; ++query)
+	{
+		const Grid::Point center{ coordinate(random), coordinate(random) };
+		const auto radius = (query % 2 == 0) ? 25.0f : 400.0f;
+
+		std::vector<EntityId> inRadius, expectedInRadius, inBox, expectedInBox;
+		grid.forEachInRadius(center, radius, [ &inRadius ] ( const EntityId id ) { inRadius.emplace_back(id); });
+		grid.forEachInBox({ center.x - radius, center.y }, { center.x, center.y + radius }, [ &inBox ] ( const EntityId id ) { inBox.emplace_back(id); });
+
+		mgr.forEach<Position>([ & ] ( const EntityId id, const Position& position ) {
+			if (distanceSquared(position, center) <= radius * radius)
+				expectedInRadius.emplace_back(id);
+			if (position.x >= center.x - radius && position.x <= center.x && position.y >= center.y && position.y <= center.y + radius)
+				expectedInBox.emplace_back(id);
+		});
+
+		REQUIRE(sorted(inRadius) == sorted(expectedInRadius));
+		REQUIRE(sorted(inBox) == sorted(expectedInBox));
+	}
+}
+
+TEST_CASE("SpatialGrid finds k nearest entities, nearest first.", "[ECS]")
+{
+	EntityManager mgr;
+	Grid grid(4.0f);
+	std::mt19937 random(11);
+	std::uniform_real_distribution<float> coordinate(-100.0f, 100.0f);
+
+	for (int i = 0; i < 1000; ++i)
+		mgr.addComponent<Position>(mgr.createEntity(), coordinate(random), coordinate(random));
+	grid.rebuild(mgr);
+
+	for (int query = 0; query < 20; ++query)
+	{
+		const Grid::Point center{ coordinate(random) * 3, coordinate(random) };
+
+		std::vector<std::pair<float, EntityId>> expected;
+		mgr.forEach<Position>([ &expected, center ] ( const EntityId id, const Position& position ) {
+			expected.emplace_back(distanceSquared(position, center), id);
+		});
+		std::sort(std::begin(expected), std::end(expected));
+
+		const auto nearest = grid.findNearest(center, 8);
+		REQUIRE(nearest.size() == 8);
+		for (std::size_t i = 0; i < nearest.size(); ++i)
+			REQUIRE(distanceSquared(mgr.getComponent<Position>(nearest[i]), center) == expected[i].first);
+	}
+
+	// Rejected entities are skipped, and fewer results are returned when there aren't enough candidates.
+	const auto first = mgr.getEntities().front();
+	const auto nearestOthers = grid.findNearest(grid.getPoint(first), 3, [ first ] ( const EntityId id ) { return id != first; });
+	REQUIRE(std::find(std::cbegin(nearestOthers), std::cend(nearestOthers), first) == std::cend(nearestOthers));
+	REQUIRE(grid.findNearest({ 0, 0 }, 5000).size() == 1000);
+}
+
+TEST_CASE("SpatialGrid updates incrementally from changed and removed position components.", "[ECS]")
+{
+	EntityManager mgr;
+	Event::Dispatcher dispatcher;
+	Grid grid(1.0f);
+
+	mgr.observe<Position>();
+	dispatcher.addCallback<ComponentsRemovedEvent<Position>>([ &grid ] ( const ComponentsRemovedEvent<Position>& event ) {
+		grid.remove(event.entities);
+	});
+
+	const auto a = mgr.createEntity();
+	const auto b = mgr.createEntity();
+	mgr.addComponent<Position>(a, 0.5f, 0.5f);
+	mgr.addComponent<Position>(b, 10.5f, 10.5f);
+
+	auto since = mgr.advanceChangeTick();
+	grid.update(mgr, 0);
+	REQUIRE(grid.getCellCount() == 2);
+
+	// Moving a across cells, b stays untouched.
+	mgr.getComponent<Position>(a).x = 10.2f;
+	mgr.getComponent<Position>(a).y = 10.7f;
+
+	const auto previous = since;
+	since = mgr.advanceChangeTick();
+	grid.update(mgr, previous);
+
+	REQUIRE(grid.getCellCount() == 1);
+	REQUIRE(grid.getPoint(a).x == 10.2f);
+	REQUIRE(sorted(grid.findNearest({ 10, 10 }, 2)) == sorted({ a, b }));
+
+	mgr.removeEntity(b);
+	mgr.flushObservers(dispatcher);
+
+	REQUIRE(grid.size() == 1);
+	REQUIRE_FALSE(grid.contains(b));
+	REQUIRE(grid.findNearest({ 10, 10 }, 2) == std::vector<EntityId>{ a });
+	REQUIRE_THROWS_AS(grid.getPoint(b), Exceptions::NotFoundError);
+
+	REQUIRE_THROWS_AS(Grid(0.0f), Exceptions::InvalidArgument);
+}
+
+TEST_CASE("SpatialGrid rejects non-finite points, and tolerates NaN in queries.", "[ECS]")
+{
+	constexpr auto nan = std::numeric_limits<float>::quiet_NaN();
+	constexpr auto infinity = std::numeric_limits<float>::infinity();
+
+	EntityManager mgr;
+	Grid grid(1.0f);
+
+	const auto a = mgr.createEntity();
+	grid.set(a, { 0.5f, 0.5f });
+
+	REQUIRE_THROWS_AS(grid.set(a, { nan, 0.0f }), Exceptions::InvalidArgument);
+	REQUIRE_THROWS_AS(grid.set(a, { 0.0f, -infinity }), Exceptions::InvalidArgument);
+	REQUIRE(grid.getPoint(a).x == 0.5f);
+
+	const auto b = mgr.createEntity();
+	mgr.addComponent<Position>(b, nan, 1.0f);
+	REQUIRE_THROWS_AS(grid.update(mgr, 0), Exceptions::InvalidArgument);
+	REQUIRE_FALSE(grid.contains(b));
+
+	std::size_t found = 0;
+	grid.forEachInBox({ nan, nan }, { 1.0f, 1.0f }, [ &found ] ( const EntityId ) { ++found; });
+	grid.forEachInRadius({ nan, 0.0f }, 1.0f, [ &found ] ( const EntityId ) { ++found; });
+	REQUIRE(found == 0);
+	REQUIRE(grid.findNearest({ 0.0f, nan }, 1).size() == 1);
+}
@@ -0,0 +1,112 @@
+#include "GameLibrary/ECS/StaticWorld.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "catch2/catch.hpp"
+
+#include "GameLibrary/ECS/Entity.h"
+#include "GameLibrary/Exceptions/Standard.h"
+
+using namespace GameLibrary;
+using namespace GameLibrary::ECS;
+
+
+namespace
+{
+	struct Position {
+		int x = 0; int y = 0;
+	};
+	struct Velocity {
+		int dx = 1; int dy = 1;
+	};
+	struct Dead {};
+
+	struct MovingEntity : BaseEntity<Position, Velocity> {};
+
+	using World = StaticWorld<Position, Velocity, Dead>;
+}
+
+
+TEST_CASE("StaticWorld adds / removes entities and components, and reports their existence.", "[ECS]")
+{
+	World world;
+
+	const auto moving = world.addEntity<MovingEntity>();
+	const auto still = world.createEntity();
+	world.addComponent<Position>(still, 5, 5);
+
+	REQUIRE(world.getCount() == 2);
+	REQUIRE((world.entityHasComponent<Position>(moving) && world.entityHasComponent<Velocity>(moving)));
+	REQUIRE_FALSE(world.entityHasComponent<Velocity>(still));
+	REQUIRE(world.getComponent<Position>(still).x == 5);
+
+	world.removeComponent<Position>(still);
+	REQUIRE_FALSE(world.entityHasComponent<Position>(still));
+	REQUIRE(world.entityExists(still));
+
+	world.removeEntity(moving);
+	REQUIRE_FALSE(world.entityExists(moving));
+	REQUIRE_FALSE(world.entityHasComponent<Position>(moving));
+	REQUIRE(world.getCount() == 1);
+
+	REQUIRE_THROWS_AS(world.addComponent<Position>(moving), Exceptions::NotFoundError);
+	REQUIRE_THROWS_AS(world.getComponent<Position>(still), Exceptions::NotFoundError);
+}
+
+TEST_CASE("StaticWorld ignores stale handles when checking and removing tags of a reused slot.", "[ECS]")
+{
+	World world;
+
+	const auto stale = world.createEntity();
+	world.removeEntity(stale);
+
+	const auto current = world.createEntity();
+	world.addComponent<Dead>(current);
+	REQUIRE(current.getIndex() == stale.getIndex());
+
+	REQUIRE_FALSE(world.entityHasComponent<Dead>(stale));
+	world.removeComponent<Dead>(stale);
+	REQUIRE(world.entityHasComponent<Dead>(current));
+	REQUIRE(world.getComponents<Dead>().size() == 1);
+}
+
+TEST_CASE("StaticWorld views behave like EntityManager's views.", "[ECS]")
+{
+	World world;
+	std::vector<EntityId> expected;
+
+	for (int i = 0; i < 20; ++i)
+	{
+		const auto id = world.addEntity<MovingEntity>();
+
+		if (i % 2 == 0)
+			world.addComponent<Dead>(id);
+		else
+			expected.emplace_back(id);
+	}
+
+	std::vector<EntityId> visited;
+	world.view<Position, Velocity>(exclude<Dead>).forEach([ &visited ] ( const EntityId id, Position& position, const Velocity& velocity ) {
+		position.x += velocity.dx;
+		visited.emplace_back(id);
+	});
+
+	std::sort(std::begin(expected), std::end(expected));
+	std::sort(std::begin(visited), std::end(visited));
+	REQUIRE(visited == expected);
+	REQUIRE(world.getComponent<Position>(expected.front()).x == 1);
+}
+
+TEST_CASE("StaticWorld::addEntities() creates a batch of entities from a generator.", "[ECS]")
+{
+	World world;
+
+	const auto ids = world.addEntities<MovingEntity>(1000, [ ] ( const std::size_t i ) {
+		return MovingEntity::ComponentsTuple{ { static_cast<int>(i), 0 }, {} };
+	});
+
+	REQUIRE(world.getCount() == 1000);
+	REQUIRE(world.getPool<Velocity>().size() == 1000);
+	REQUIRE(world.getComponent<Position>(ids[500]).x == 500);
+}
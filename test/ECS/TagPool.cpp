@@ -0,0 +1,123 @@
+#include "GameLibrary/ECS/Storage/TagPool.h"
+
+#include <type_traits>
+#include <vector>
+
+#include "catch2/catch.hpp"
+
+#include "GameLibrary/ECS/Component.h"
+#include "GameLibrary/ECS/EntityManager.h"
+#include "GameLibrary/Exceptions/Standard.h"
+
+using namespace GameLibrary;
+using namespace GameLibrary::ECS;
+
+
+namespace
+{
+	EntityId entity(const EntityId::Index index) {
+		return EntityId(index, 0);
+	}
+
+	struct Position {
+		int x = 0; int y = 0;
+	};
+	struct Enemy {};
+	struct Dead : BaseComponent {};
+}
+
+
+TEST_CASE("Empty component types are stored in TagPools.", "[ECS]")
+{
+	static_assert(std::is_same_v<PoolFor<Enemy>, TagPool<Enemy>>);
+	static_assert(std::is_same_v<PoolFor<Dead>, TagPool<Dead>>);
+	static_assert(std::is_same_v<PoolFor<Position>, ComponentPool<Position>>);
+
+	TagPool<Enemy> pool;
+
+	for (EntityId::Index index = 0; index < 200; index += 3)
+		pool.emplace(entity(index));
+	pool.emplace(entity(3));
+
+	REQUIRE(pool.size() == 67);
+	REQUIRE(pool.getWords().size() == 4);
+	REQUIRE(pool.contains(entity(198)));
+	REQUIRE_FALSE(pool.contains(entity(199)));
+	REQUIRE_FALSE(pool.contains(entity(100000)));
+
+	pool.remove(entity(3));
+	pool.remove(entity(4));
+	REQUIRE(pool.size() == 66);
+	REQUIRE_THROWS_AS(pool.get(entity(3)), Exceptions::NotFoundError);
+
+	std::vector<std::size_t> indices;
+	forEachSetIndex(pool.getWords()[0], 0, [ &indices ] ( const std::size_t index ) { indices.emplace_back(index); });
+	REQUIRE(indices.size() == 21);
+	REQUIRE(indices[1] == 6);
+}
+
+TEST_CASE("EntityManager filters entities by tags, with forEachTagged() and Views.", "[ECS]")
+{
+	EntityManager mgr;
+	std::vector<EntityId> ids;
+
+	for (int i = 0; i < 300; ++i)
+	{
+		const auto id = ids.emplace_back(mgr.createEntity());
+		mgr.addComponent<Position>(id, i, 0);
+
+		if (i % 2 == 0)
+			mgr.addComponent<Enemy>(id);
+		if (i % 3 == 0)
+			mgr.addComponent<Dead>(id);
+	}
+
+	std::vector<EntityId> aliveEnemies;
+	mgr.forEachTagged<Enemy>(exclude<Dead>, [ &aliveEnemies ] ( const EntityId id ) { aliveEnemies.emplace_back(id); });
+
+	REQUIRE(aliveEnemies.size() == 100);
+	for (const auto id : aliveEnemies)
+		REQUIRE((mgr.getComponent<Position>(id).x % 2 == 0 && mgr.getComponent<Position>(id).x % 3 != 0));
+
+	int viewed = 0;
+	mgr.view<Position, Enemy>(exclude<Dead>).forEach([ &viewed ] ( const Position& position, Enemy& ) {
+		REQUIRE(position.x % 6 != 0);
+		++viewed;
+	});
+	REQUIRE(viewed == 100);
+
+	// Handles reported by forEachTagged() are current, and stale handles don't see tags of slot's new entity.
+	mgr.removeEntity(ids[0]);
+	const auto reused = mgr.createEntity();
+	mgr.addComponent<Enemy>(reused);
+	REQUIRE(mgr.entityHasComponent<Enemy>(reused));
+	REQUIRE_FALSE(mgr.entityHasComponent<Enemy>(ids[0]));
+
+	std::size_t enemies = 0;
+	mgr.forEachTagged<Enemy>([ &enemies, reused ] ( const EntityId id ) { enemies += (id == reused) ? 100 : 1; });
+	REQUIRE(enemies == 249);
+}
+
+TEST_CASE("EntityManager ignores stale handles to reused slots when removing tags.", "[ECS]")
+{
+	EntityManager mgr;
+
+	const auto stale = mgr.createEntity();
+	mgr.addComponent<Enemy>(stale);
+	mgr.removeEntity(stale);
+
+	const auto current = mgr.createEntity();
+	mgr.addComponent<Enemy>(current);
+	mgr.addComponent<Dead>(current);
+	REQUIRE(current.getIndex() == stale.getIndex());
+
+	REQUIRE_FALSE(mgr.entityHasComponent<Enemy>(stale));
+	mgr.removeComponent<Enemy>(stale);
+	mgr.removeEntity(stale);
+
+	REQUIRE(mgr.entityHasComponent<Enemy>(current));
+	REQUIRE(mgr.entityHasComponent<Dead>(current));
+	REQUIRE(mgr.getStorage().getPool<Enemy>().size() == 1);
+	REQUIRE(mgr.getStorage().getPool<Dead>().size() == 1);
+	REQUIRE(mgr.getStorage().contains(current));
+}
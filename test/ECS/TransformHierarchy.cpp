@@ -0,0 +1,191 @@
+#include "GameLibrary/ECS/TransformHierarchy.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "catch2/catch.hpp"
+
+#include "GameLibrary/ECS/EntityManager.h"
+#include "GameLibrary/Exceptions/Standard.h"
+
+using namespace GameLibrary;
+using namespace GameLibrary::ECS;
+
+
+namespace
+{
+	struct Offset {
+		int x = 0; int y = 0;
+
+		Offset operator* (const Offset& local) const {
+			return { x + local.x, y + local.y };
+		}
+
+		bool operator== (const Offset& other) const {
+			return x == other.x && y == other.y;
+		}
+	};
+
+	using Hierarchy = TransformHierarchy<Offset>;
+
+	std::vector<EntityId> createEntities(EntityManager& mgr, const std::size_t count) {
+		std::vector<EntityId> ids;
+		for (std::size_t i = 0; i < count; ++i)
+			ids.emplace_back(mgr.createEntity());
+
+		return ids;
+	}
+
+	// Every subtree must be a contiguous range right after its root.
+	void requireDepthFirstOrder(const Hierarchy& hierarchy) {
+		const auto& entities = hierarchy.getEntities();
+
+		for (std::size_t i = 0; i < entities.size(); ++i)
+		{
+			const auto parent = hierarchy.getParent(entities[i]);
+			if (parent.isNull())
+				continue;
+
+			const auto parentPosition = static_cast<std::size_t>(std::find(std::begin(entities), std::end(entities), parent) - std::begin(entities));
+			REQUIRE(parentPosition < i);
+			REQUIRE(i < parentPosition + hierarchy.getSubtreeSize(parent));
+		}
+	}
+}
+
+
+TEST_CASE("TransformHierarchy propagates world transforms from parents to children.", "[ECS]")
+{
+	EntityManager mgr;
+	const auto ids = createEntities(mgr, 4);
+	Hierarchy hierarchy;
+
+	hierarchy.insert(ids[0], { 10, 0 });
+	hierarchy.insert(ids[1], { 1, 0 }, ids[0]);
+	hierarchy.insert(ids[2], { 0, 1 }, ids[1]);
+	hierarchy.insert(ids[3], { 5, 5 });
+	hierarchy.update();
+
+	REQUIRE(hierarchy.getWorld(ids[2]) == Offset{ 11, 1 });
+	REQUIRE(hierarchy.getWorld(ids[3]) == Offset{ 5, 5 });
+	REQUIRE(hierarchy.getSubtreeSize(ids[0]) == 3);
+	requireDepthFirstOrder(hierarchy);
+
+	hierarchy.setLocal(ids[0], { 20, 0 });
+	REQUIRE(hierarchy.getWorld(ids[2]) == Offset{ 11, 1 });
+
+	hierarchy.update();
+	REQUIRE(hierarchy.getWorld(ids[1]) == Offset{ 21, 0 });
+	REQUIRE(hierarchy.getWorld(ids[2]) == Offset{ 21, 1 });
+	REQUIRE(hierarchy.getLocal(ids[2]) == Offset{ 0, 1 });
+
+	REQUIRE_THROWS_AS(hierarchy.insert(ids[1], {}), Exceptions::InvalidArgument);
+	REQUIRE_THROWS_AS(hierarchy.insert(mgr.createEntity(), {}, mgr.createEntity()), Exceptions::NotFoundError);
+	REQUIRE_THROWS_AS(hierarchy.getWorld(EntityId()), Exceptions::NotFoundError);
+}
+
+TEST_CASE("TransformHierarchy moves subtrees between parents in place.", "[ECS]")
+{
+	EntityManager mgr;
+	const auto ids = createEntities(mgr, 6);
+	Hierarchy hierarchy;
+
+	// 0 -> (1 -> 2), 3 -> 4, 5
+	hierarchy.insert(ids[0], { 100, 0 });
+	hierarchy.insert(ids[1], { 10, 0 }, ids[0]);
+	hierarchy.insert(ids[2], { 1, 0 }, ids[1]);
+	hierarchy.insert(ids[3], { 0, 100 });
+	hierarchy.insert(ids[4], { 0, 10 }, ids[3]);
+	hierarchy.insert(ids[5], { 0, 0 });
+	hierarchy.update();
+
+	REQUIRE_THROWS_AS(hierarchy.setParent(ids[0], ids[2]), Exceptions::InvalidArgument);
+	REQUIRE_THROWS_AS(hierarchy.setParent(ids[0], ids[0]), Exceptions::InvalidArgument);
+
+	SECTION("Forward, under a later root")
+	{
+		hierarchy.setParent(ids[1], ids[3]);
+		hierarchy.update();
+
+		REQUIRE(hierarchy.getParent(ids[1]) == ids[3]);
+		REQUIRE(hierarchy.getWorld(ids[2]) == Offset{ 11, 100 });
+		REQUIRE(hierarchy.getSubtreeSize(ids[0]) == 1);
+		REQUIRE(hierarchy.getSubtreeSize(ids[3]) == 4);
+	}
+
+	SECTION("Backward, under an earlier node")
+	{
+		hierarchy.setParent(ids[3], ids[1]);
+		hierarchy.update();
+
+		REQUIRE(hierarchy.getWorld(ids[4]) == Offset{ 110, 110 });
+		REQUIRE(hierarchy.getSubtreeSize(ids[0]) == 5);
+	}
+
+	SECTION("Up, to own grandparent and to roots")
+	{
+		hierarchy.setParent(ids[2], ids[0]);
+		hierarchy.setParent(ids[4], EntityId());
+		hierarchy.update();
+
+		REQUIRE(hierarchy.getWorld(ids[2]) == Offset{ 101, 0 });
+		REQUIRE(hierarchy.getSubtreeSize(ids[1]) == 1);
+		REQUIRE(hierarchy.getParent(ids[4]).isNull());
+		REQUIRE(hierarchy.getWorld(ids[4]) == Offset{ 0, 10 });
+	}
+
+	SECTION("Several moves in one batch")
+	{
+		hierarchy.setParent(ids[5], ids[2]);
+		hierarchy.setParent(ids[0], ids[4]);
+		hierarchy.setParent(ids[1], EntityId());
+		hierarchy.update();
+
+		REQUIRE(hierarchy.getWorld(ids[5]) == Offset{ 11, 0 });
+		REQUIRE(hierarchy.getWorld(ids[0]) == Offset{ 100, 110 });
+		REQUIRE(hierarchy.getSubtreeSize(ids[3]) == 3);
+	}
+
+	requireDepthFirstOrder(hierarchy);
+	REQUIRE(hierarchy.size() == 6);
+}
+
+TEST_CASE("TransformHierarchy removes whole subtrees in batches.", "[ECS]")
+{
+	EntityManager mgr;
+	const auto ids = createEntities(mgr, 6);
+	Hierarchy hierarchy;
+
+	hierarchy.insert(ids[0], {});
+	hierarchy.insert(ids[1], {}, ids[0]);
+	hierarchy.insert(ids[2], {}, ids[1]);
+	hierarchy.insert(ids[3], {}, ids[0]);
+	hierarchy.insert(ids[4], {});
+	hierarchy.insert(ids[5], {}, ids[4]);
+
+	// Nested and repeated removals in one batch.
+	hierarchy.remove(ids[2]);
+	hierarchy.remove({ ids[1], ids[5], ids[1] });
+	REQUIRE(hierarchy.contains(ids[1]));
+
+	hierarchy.update(mgr);
+
+	REQUIRE(hierarchy.size() == 3);
+	REQUIRE_FALSE(hierarchy.contains(ids[1]));
+	REQUIRE_FALSE(hierarchy.contains(ids[2]));
+	REQUIRE(hierarchy.getSubtreeSize(ids[0]) == 2);
+	REQUIRE(hierarchy.getSubtreeSize(ids[4]) == 1);
+	requireDepthFirstOrder(hierarchy);
+
+	REQUIRE_FALSE(mgr.entityExists(ids[1]));
+	REQUIRE_FALSE(mgr.entityExists(ids[2]));
+	REQUIRE_FALSE(mgr.entityExists(ids[5]));
+	REQUIRE(mgr.entityExists(ids[3]));
+
+	// Removed entities' slots may be reused.
+	const auto reused = mgr.createEntity();
+	hierarchy.insert(reused, { 1, 1 }, ids[3]);
+	hierarchy.update();
+	REQUIRE(hierarchy.getSubtreeSize(ids[0]) == 3);
+	requireDepthFirstOrder(hierarchy);
+}
@@ -0,0 +1,174 @@
+#include "GameLibrary/ECS/View.h"
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include "catch2/catch.hpp"
+
+#include "GameLibrary/ECS/EntityManager.h"
+
+using namespace GameLibrary::ECS;
+
+
+namespace
+{
+	struct Position {
+		int x = 0; int y = 0;
+	};
+	struct Velocity {
+		int dx = 0; int dy = 0;
+	};
+	struct Dead {};
+}
+
+
+TEST_CASE("View iterates only entities having all requested components, and none of excluded ones.", "[ECS]")
+{
+	EntityManager mgr;
+	std::vector<EntityManager::Id> expected;
+
+	std::vector<EntityManager::Id> ids;
+
+	for (int i = 0; i < 30; ++i)
+	{
+		const auto id = ids.emplace_back(mgr.createEntity());
+
+		mgr.addComponent<Position>(id, i, 0);
+
+		if (i % 2 == 0)
+			mgr.addComponent<Velocity>(id, 1, 2);
+		if (i % 3 == 0)
+			mgr.addComponent<Dead>(id);
+
+		if (i % 2 == 0 && i % 3 != 0)
+			expected.emplace_back(id);
+	}
+
+	SECTION("Range-based iteration yields ids and component references.")
+	{
+		std::vector<EntityManager::Id> visited;
+
+		for (auto [id, position, velocity] : mgr.view<Position, Velocity>(exclude<Dead>))
+		{
+			position.x += velocity.dx;
+			visited.emplace_back(id);
+		}
+
+		std::sort(std::begin(visited), std::end(visited));
+		REQUIRE(visited == expected);
+		REQUIRE(mgr.getComponent<Position>(ids[2]).x == 3);
+		REQUIRE(mgr.getComponent<Position>(ids[6]).x == 6);
+	}
+
+	SECTION("forEach() accepts callbacks with or without id parameter.")
+	{
+		std::vector<EntityManager::Id> visited;
+		int velocitySum = 0;
+
+		auto view = mgr.view<Velocity, Position>(exclude<Dead>);
+		view.forEach([ &visited ] ( const EntityId id, Velocity&, Position& ) { visited.emplace_back(id); });
+		view.forEach([ &velocitySum ] ( const Velocity& velocity, const Position& ) { velocitySum += velocity.dy; });
+
+		std::sort(std::begin(visited), std::end(visited));
+		REQUIRE(visited == expected);
+		REQUIRE(velocitySum == 2 * static_cast<int>(expected.size()));
+	}
+
+	SECTION("View is driven by its smallest pool.")
+	{
+		REQUIRE(mgr.view<Position, Velocity>().sizeHint() == 15);
+		REQUIRE(mgr.view<Position>().sizeHint() == 30);
+	}
+}
+
+TEST_CASE("View over a component type nobody has is empty.", "[ECS]")
+{
+	struct Unused {};
+
+	EntityManager mgr;
+	const auto id = mgr.createEntity();
+	mgr.addComponent<Position>(id);
+
+	auto view = mgr.view<Position, Unused>();
+	REQUIRE(view.begin() == view.end());
+	REQUIRE_FALSE(view.contains(id));
+	REQUIRE(mgr.view<Position>(exclude<Unused>).contains(id));
+}
+
+TEST_CASE("View::parallelForEach() visits every entity of the View once.", "[ECS]")
+{
+	GameLibrary::Utilities::ThreadPool threadPool(4);
+	EntityManager mgr;
+	constexpr int entityCount = 20'000;
+	std::vector<EntityManager::Id> ids;
+
+	for (int i = 0; i < entityCount; ++i)
+	{
+		const auto id = ids.emplace_back(mgr.createEntity());
+		mgr.addComponent<Position>(id);
+
+		if (i % 4 == 0)
+			mgr.addComponent<Dead>(id);
+	}
+
+	mgr.view<Position>(exclude<Dead>).parallelForEach(threadPool, [ ] ( Position& position ) { ++position.x; });
+	mgr.view<Position>(exclude<Dead>).parallelForEach(threadPool, [ ] ( const EntityId id, Position& position ) {
+		position.y = static_cast<int>(id.getIndex());
+	}, { 100, true });
+
+	for (int i = 0; i < entityCount; ++i)
+	{
+		const auto& position = mgr.getComponent<Position>(ids[i]);
+		const bool isDead = (i % 4 == 0);
+
+		REQUIRE(position.x == (isDead ? 0 : 1));
+		REQUIRE(position.y == (isDead ? 0 : static_cast<int>(ids[i].getIndex())));
+	}
+}
+
+TEST_CASE("View::changed() and View::added() visit only components changed / added after a tick.", "[ECS]")
+{
+	EntityManager mgr;
+	std::vector<EntityManager::Id> ids;
+
+	for (int i = 0; i < 100; ++i)
+	{
+		ids.emplace_back(mgr.createEntity());
+		mgr.addComponent<Position>(ids.back(), i, 0);
+		mgr.addComponent<Velocity>(ids.back());
+	}
+
+	const auto since = mgr.advanceChangeTick();
+
+	mgr.getComponent<Position>(ids[3]).x = -3;
+	mgr.getComponent<Position>(ids[3]).x = -4;
+	mgr.markComponentChanged<Position>(ids[50]);
+	mgr.addComponent<Position>(ids.emplace_back(mgr.createEntity()), 1000, 0);
+	mgr.addComponent<Velocity>(ids.back());
+	// Removed entity is not reported, even though it changed.
+	mgr.markComponentChanged<Position>(ids[7]);
+	mgr.removeEntity(ids[7]);
+	// Reading through const manager doesn't mark the component changed.
+	REQUIRE(std::as_const(mgr).getComponent<Velocity>(ids[20]).dx == 0);
+
+	const auto collect = [ ] ( const auto& filter ) {
+		std::vector<EntityManager::Id> visited;
+		filter.forEach([ &visited ] ( const EntityManager::Id id, Position&, Velocity& ) { visited.emplace_back(id); });
+
+		return visited;
+	};
+
+	const auto view = mgr.view<Position, Velocity>();
+	REQUIRE(collect(view.changed<Position>(since)) == std::vector<EntityManager::Id>{ ids[3], ids[50], ids[100] });
+	REQUIRE(collect(view.added<Position>(since)) == std::vector<EntityManager::Id>{ ids[100] });
+	REQUIRE(collect(view.changed<Velocity>(since)) == std::vector<EntityManager::Id>{ ids[100] });
+
+	// Nothing changed after the next tick started.
+	const auto later = mgr.advanceChangeTick();
+	REQUIRE(collect(view.changed<Position>(later)).empty());
+
+	// Marking the same component again reports it once, in order of its latest change.
+	mgr.markComponentChanged<Position>(ids[3]);
+	REQUIRE(collect(view.changed<Position>(since)) == std::vector<EntityManager::Id>{ ids[50], ids[100], ids[3] });
+}
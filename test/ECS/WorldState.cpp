@@ -0,0 +1,114 @@
+#include "GameLibrary/ECS/WorldState.h"
+
+#include <vector>
+
+#include "catch2/catch.hpp"
+
+#include "GameLibrary/ECS/EntityManager.h"
+#include "GameLibrary/Exceptions/Standard.h"
+
+using namespace GameLibrary;
+using namespace GameLibrary::ECS;
+
+
+namespace
+{
+	struct Position {
+		int x = 0; int y = 0;
+	};
+	struct Velocity {
+		int dx = 1; int dy = 1;
+	};
+	struct Frozen {};
+	struct Untracked {};
+
+	struct Mover : BaseEntity<Position, Velocity> {};
+
+	using State = WorldState<Position, Velocity, Frozen>;
+}
+
+
+TEST_CASE("WorldState restores entities and components captured earlier.", "[ECS]")
+{
+	EntityManager mgr;
+	const auto first = mgr.addEntity<Mover>({ Position{ 1, 1 }, Velocity{} });
+	const auto second = mgr.addEntity<Mover>({ Position{ 2, 2 }, Velocity{} });
+	mgr.addComponent<Frozen>(second);
+
+	State state;
+	REQUIRE_FALSE(state.isCaptured());
+	REQUIRE_THROWS_AS(state.restore(mgr), Exceptions::NotFoundError);
+
+	state.capture(mgr);
+	REQUIRE(state.getEntityCount() == 2);
+
+	// Diverge: move, remove, create and tag entities.
+	mgr.getComponent<Position>(first).x = 100;
+	mgr.removeEntity(second);
+	const auto third = mgr.addEntity<Mover>();
+	mgr.addComponent<Untracked>(first);
+
+	state.restore(mgr);
+
+	REQUIRE(mgr.getCount() == 2);
+	REQUIRE(mgr.getComponent<Position>(first).x == 1);
+	REQUIRE(mgr.entityExists(second));
+	REQUIRE(mgr.getComponent<Position>(second).x == 2);
+	REQUIRE(mgr.entityHasComponent<Frozen>(second));
+	REQUIRE_FALSE(mgr.entityExists(third));
+	REQUIRE_FALSE(mgr.entityHasComponent<Untracked>(first));
+
+	std::vector<EntityId> moving;
+	mgr.view<Position, Velocity>(exclude<Frozen>).forEach([ & ] ( const EntityId id, Position&, Velocity& ) { moving.emplace_back(id); });
+	REQUIRE(moving == std::vector<EntityId>{ first });
+
+	// Restored state diverges again the same way.
+	mgr.removeEntity(second);
+	REQUIRE(mgr.addEntity<Mover>() == third);
+}
+
+TEST_CASE("WorldState keeps owning groups packed across restore.", "[ECS]")
+{
+	EntityManager mgr;
+	const auto group = mgr.group<Position, Velocity>();
+
+	const auto first = mgr.addEntity<Mover>();
+	mgr.addComponent<Position>(mgr.createEntity());
+
+	State state;
+	state.capture(mgr);
+
+	mgr.addEntity<Mover>();
+	mgr.removeEntity(first);
+
+	state.restore(mgr);
+
+	REQUIRE(group.size() == 1);
+	REQUIRE(group.contains(first));
+}
+
+TEST_CASE("WorldStateHistory holds last frames and rolls back to any of them.", "[ECS]")
+{
+	REQUIRE_THROWS_AS(WorldStateHistory<Position>(0), Exceptions::InvalidArgument);
+
+	EntityManager mgr;
+	const auto id = mgr.addEntity<Mover>();
+	WorldStateHistory<Position, Velocity, Frozen> history(4);
+
+	for (WorldStateHistory<Position>::Frame frame = 0; frame < 6; ++frame)
+	{
+		mgr.getComponent<Position>(id).x = static_cast<int>(frame);
+		history.capture(mgr, frame);
+	}
+
+	REQUIRE_FALSE(history.contains(1));
+	REQUIRE(history.contains(2));
+	REQUIRE(history.contains(5));
+	REQUIRE_THROWS_AS(history.restore(mgr, 0), Exceptions::NotFoundError);
+
+	history.restore(mgr, 3);
+	REQUIRE(mgr.getComponent<Position>(id).x == 3);
+
+	history.restore(mgr, 5);
+	REQUIRE(mgr.getComponent<Position>(id).x == 5);
+}
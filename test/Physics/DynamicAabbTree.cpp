@@ -0,0 +1,126 @@
+#include "GameLibrary/Physics/DynamicAabbTree.h"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "catch2/catch.hpp"
+
+#include "GameLibrary/ECS/EntityManager.h"
+#include "GameLibrary/Event/Dispatcher.h"
+#include "GameLibrary/Exceptions/Standard.h"
+#include "GameLibrary/Physics/SweepAndPrune.h"
+
+using namespace GameLibrary;
+using namespace GameLibrary::ECS;
+using namespace GameLibrary::Physics;
+
+
+TEST_CASE("DynamicAabbTree stays balanced and finds same pairs as SweepAndPrune while boxes move.", "[Physics]")
+{
+	EntityManager mgr;
+	DynamicAabbTree tree(0.5f);
+	SweepAndPrune sweepAndPrune;
+	PairBuffer treePairs, expectedPairs;
+	std::mt19937 random(5);
+	std::uniform_real_distribution<float> coordinate(0.0f, 300.0f);
+	std::uniform_real_distribution<float> step(-2.0f, 2.0f);
+
+	for (int i = 0; i < 1000; ++i)
+	{
+		const auto x = coordinate(random);
+		const auto y = coordinate(random);
+
+		mgr.addComponent<Collider>(mgr.createEntity(), Collider{ { x, y, x + 4, y + 4 }, i % 4 == 0 });
+	}
+
+	ChangeTick since = 0;
+	for (int frame = 0; frame < 10; ++frame)
+	{
+		const auto previous = since;
+		since = mgr.advanceChangeTick();
+		tree.update(mgr, previous);
+
+		tree.findPairs(treePairs);
+		sweepAndPrune.findPairs(mgr, expectedPairs);
+		std::sort(std::begin(treePairs), std::end(treePairs));
+		std::sort(std::begin(expectedPairs), std::end(expectedPairs));
+
+		REQUIRE(tree.size() == 1000);
+		REQUIRE(treePairs == expectedPairs);
+		REQUIRE(tree.getHeight() <= 2 * static_cast<int>(std::log2(1000.0)) + 2);
+
+		// Move dynamic boxes only.
+		for (const auto id : mgr.getEntities())
+		{
+			auto& collider = mgr.getComponent<Collider>(id);
+			if (collider.isStatic)
+				continue;
+
+			const auto dx = step(random) * 3, dy = step(random) * 3;
+			collider.bounds = { collider.bounds.minX + dx, collider.bounds.minY + dy, collider.bounds.maxX + dx, collider.bounds.maxY + dy };
+		}
+	}
+}
+
+TEST_CASE("DynamicAabbTree keeps fat boxes, and only reinserts proxies leaving them.", "[Physics]")
+{
+	DynamicAabbTree tree(1.0f);
+
+	const auto proxy = tree.createProxy({ 0, 0, 2, 2 }, EntityId(0, 0));
+	tree.createProxy({ 10, 10, 12, 12 }, EntityId(1, 0), true);
+
+	REQUIRE(tree.getFatBounds(proxy).minX == -1.0f);
+	REQUIRE_FALSE(tree.moveProxy(proxy, { 0.5f, 0.5f, 2.5f, 2.5f }));
+	REQUIRE(tree.moveProxy(proxy, { 9, 9, 11, 11 }));
+
+	std::vector<EntityId> found;
+	tree.query({ 10, 10, 10, 10 }, [ &tree, &found ] ( const DynamicAabbTree::ProxyId other ) { found.emplace_back(tree.getEntity(other)); });
+	REQUIRE(found.size() == 2);
+
+	PairBuffer pairs;
+	tree.findPairs(pairs);
+	REQUIRE(pairs == PairBuffer{ { EntityId(0, 0), EntityId(1, 0) } });
+
+	// Two static proxies never pair.
+	tree.setStatic(proxy, true);
+	tree.findPairs(pairs);
+	REQUIRE(pairs.empty());
+	tree.setStatic(proxy, false);
+	tree.findPairs(pairs);
+	REQUIRE(pairs.size() == 1);
+
+	tree.destroyProxy(proxy);
+	tree.findPairs(pairs);
+	REQUIRE(pairs.empty());
+	REQUIRE(tree.getHeight() == 0);
+
+	REQUIRE_THROWS_AS(DynamicAabbTree(-1.0f), Exceptions::InvalidArgument);
+}
+
+TEST_CASE("DynamicAabbTree drops proxies of removed colliders.", "[Physics]")
+{
+	EntityManager mgr;
+	Event::Dispatcher dispatcher;
+	DynamicAabbTree tree;
+
+	mgr.observe<Collider>();
+	dispatcher.addCallback<ComponentsRemovedEvent<Collider>>([ &tree ] ( const ComponentsRemovedEvent<Collider>& event ) {
+		tree.remove(event.entities);
+	});
+
+	const auto first = mgr.createEntity();
+	const auto second = mgr.createEntity();
+	mgr.addComponent<Collider>(first, Collider{ { 0, 0, 1, 1 } });
+	mgr.addComponent<Collider>(second, Collider{ { 0, 0, 1, 1 } });
+	tree.update(mgr, 0);
+
+	mgr.removeComponent<Collider>(first);
+	mgr.removeEntity(second);
+	mgr.flushObservers(dispatcher);
+
+	REQUIRE(tree.size() == 0);
+	REQUIRE_FALSE(tree.contains(first));
+	REQUIRE(tree.getHeight() == -1);
+}
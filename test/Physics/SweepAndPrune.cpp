@@ -0,0 +1,81 @@
+#include "GameLibrary/Physics/SweepAndPrune.h"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "catch2/catch.hpp"
+
+#include "GameLibrary/ECS/EntityManager.h"
+#include "GameLibrary/Physics/Collider.h"
+
+using namespace GameLibrary;
+using namespace GameLibrary::ECS;
+using namespace GameLibrary::Physics;
+
+
+namespace
+{
+	PairBuffer findPairsBruteForce(EntityManager& mgr) {
+		PairBuffer pairs;
+		const auto& entities = mgr.getEntities();
+
+		for (std::size_t i = 0; i < entities.size(); ++i)
+		{
+			for (auto j = i + 1; j < entities.size(); ++j)
+			{
+				const auto& first = mgr.getComponent<Collider>(entities[i]);
+				const auto& second = mgr.getComponent<Collider>(entities[j]);
+
+				if (!(first.isStatic && second.isStatic) && first.bounds.overlaps(second.bounds))
+					pairs.emplace_back(makeOverlapPair(entities[i], entities[j]));
+			}
+		}
+
+		std::sort(std::begin(pairs), std::end(pairs));
+		return pairs;
+	}
+}
+
+
+TEST_CASE("SweepAndPrune finds same overlapping pairs as testing all pairs.", "[Physics]")
+{
+	EntityManager mgr;
+	SweepAndPrune broadphase;
+	PairBuffer pairs;
+	std::mt19937 random(3);
+	std::uniform_real_distribution<float> coordinate(0.0f, 200.0f);
+	std::uniform_real_distribution<float> extent(0.5f, 6.0f);
+
+	for (int i = 0; i < 600; ++i)
+	{
+		const auto x = coordinate(random);
+		// Boxes spread along y more than x, so y is picked as sweep axis.
+		const auto y = coordinate(random) * 3;
+
+		mgr.addComponent<Collider>(mgr.createEntity(), Collider{ { x, y, x + extent(random), y + extent(random) }, i % 3 == 0 });
+	}
+
+	broadphase.findPairs(mgr, pairs);
+	std::sort(std::begin(pairs), std::end(pairs));
+
+	REQUIRE(broadphase.size() == 600);
+	REQUIRE_FALSE(pairs.empty());
+	REQUIRE(pairs == findPairsBruteForce(mgr));
+}
+
+TEST_CASE("SweepAndPrune reports touching boxes, and skips pairs of static boxes.", "[Physics]")
+{
+	SweepAndPrune broadphase;
+	PairBuffer pairs{ { EntityId(9, 0), EntityId(9, 0) } };
+
+	broadphase.add(EntityId(2, 0), { 0, 0, 1, 1 });
+	broadphase.add(EntityId(1, 0), { 1, 1, 2, 2 });
+	broadphase.add(EntityId(3, 0), { 0, 0, 5, 5 }, true);
+	broadphase.add(EntityId(4, 0), { 4, 4, 6, 6 }, true);
+
+	broadphase.findPairs(pairs);
+	std::sort(std::begin(pairs), std::end(pairs));
+
+	REQUIRE(pairs == PairBuffer{ { EntityId(1, 0), EntityId(2, 0) }, { EntityId(1, 0), EntityId(3, 0) }, { EntityId(2, 0), EntityId(3, 0) } });
+}
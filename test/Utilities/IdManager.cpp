@@ -46,12 +46,21 @@ TEST_CASE("SequentialIdManager returns sequentially generated ids, and immediate
 		for (const auto id : usedIds)
 			mgr.free(id);
 
+		REQUIRE(mgr.getUsedCount() == 0);
+		REQUIRE(mgr.getFreeCount() == numIds);
+
 		// Get some ids again. Make sure they're the same ones.
 		std::set<int> reusedIds;
 		for (int i = 0; i < numIds; ++i)
 			reusedIds.emplace(mgr.get());
 
 		REQUIRE(usedIds == reusedIds);
+		REQUIRE(mgr.getUsedCount() == numIds);
+		REQUIRE(mgr.getFreeCount() == 0);
+
+		// Reused ids can be freed again.
+		mgr.free(*std::cbegin(reusedIds));
+		REQUIRE(mgr.getFreeCount() == 1);
 	}
 }
 
@@ -0,0 +1,38 @@
+#include "GameLibrary/Utilities/MappedFile.h"
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+#include "catch2/catch.hpp"
+
+#include "GameLibrary/Exceptions/Standard.h"
+
+using namespace GameLibrary;
+using namespace GameLibrary::Utilities;
+
+
+TEST_CASE("MappedFile exposes content of a file.", "[utilities]")
+{
+	const auto path = (std::filesystem::temp_directory_path() / "GameLibraryTest_MappedFile.bin").string();
+	const std::string content = "Mapped file content.";
+
+	std::ofstream(path, std::ios::binary | std::ios::trunc) << content;
+	{
+		const MappedFile file(path);
+
+		REQUIRE(file.size() == content.size());
+		REQUIRE(std::memcmp(file.data(), content.data(), content.size()) == 0);
+	}
+
+	std::ofstream(path, std::ios::binary | std::ios::trunc);
+	{
+		const MappedFile file(path);
+
+		REQUIRE(file.size() == 0);
+	}
+
+	std::filesystem::remove(path);
+	REQUIRE_THROWS_AS(MappedFile(path), Exceptions::IoError);
+}
@@ -0,0 +1,101 @@
+#include "GameLibrary/Utilities/ThreadPool.h"
+
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "catch2/catch.hpp"
+
+#include "GameLibrary/Exceptions/Standard.h"
+
+using namespace GameLibrary;
+using namespace GameLibrary::Utilities;
+
+
+TEST_CASE("ThreadPool::parallelFor() visits every index exactly once.", "[utilities]")
+{
+	ThreadPool pool(4);
+	constexpr std::size_t count = 10'000;
+
+	std::vector<int> visits(count, 0);
+
+	SECTION("Automatic grain size.")
+	{
+		pool.parallelFor(count, [ &visits ] ( const std::size_t begin, const std::size_t end ) {
+			for (auto i = begin; i < end; ++i)
+				++visits[i];
+		});
+	}
+
+	SECTION("Nested parallelFor() called from within tasks.")
+	{
+		pool.parallelFor(10, [ &pool, &visits ] ( const std::size_t outerBegin, const std::size_t outerEnd ) {
+			for (auto outer = outerBegin; outer < outerEnd; ++outer)
+			{
+				pool.parallelFor(count / 10, [ &visits, outer ] ( const std::size_t begin, const std::size_t end ) {
+					for (auto i = begin; i < end; ++i)
+						++visits[outer * (count / 10) + i];
+				}, { 7 });
+			}
+		}, { 1 });
+	}
+
+	for (const auto visitCount : visits)
+		REQUIRE(visitCount == 1);
+}
+
+TEST_CASE("Deterministic ThreadPool::parallelFor() produces the same ranges on the same threads every time.", "[utilities]")
+{
+	ThreadPool pool(3);
+	constexpr std::size_t count = 1000;
+
+	const auto recordRanges = [ &pool ] ( const ParallelForOptions options ) {
+		std::mutex mutex;
+		std::map<std::size_t, std::pair<std::size_t, std::thread::id>> ranges;
+
+		pool.parallelFor(count, [ & ] ( const std::size_t begin, const std::size_t end ) {
+			std::lock_guard lock(mutex);
+			ranges.try_emplace(begin, end, std::this_thread::get_id());
+		}, options);
+
+		return ranges;
+	};
+
+	SECTION("One range per thread by default.")
+	{
+		const auto ranges = recordRanges({ 0, true });
+
+		REQUIRE(ranges.size() == 3);
+		REQUIRE(ranges == recordRanges({ 0, true }));
+	}
+
+	SECTION("Ranges of requested grain size.")
+	{
+		const auto ranges = recordRanges({ 64, true });
+
+		REQUIRE(ranges.size() == 16);
+		REQUIRE(ranges.at(960).first == count);
+		REQUIRE(ranges == recordRanges({ 64, true }));
+	}
+}
+
+TEST_CASE("ThreadPool::parallelFor() rethrows exception thrown by a task after all tasks finish.", "[utilities]")
+{
+	ThreadPool pool(2);
+	std::atomic<std::size_t> visited{0};
+
+	const auto throwOnFirstRange = [ &visited ] ( const std::size_t begin, const std::size_t end ) {
+		visited += end - begin;
+
+		if (begin == 0)
+			throw std::runtime_error("First range failed.");
+	};
+
+	REQUIRE_THROWS_AS(pool.parallelFor(100, throwOnFirstRange, { 10 }), std::runtime_error);
+	REQUIRE(visited == 100);
+
+	REQUIRE_THROWS_AS(ThreadPool(0), Exceptions::InvalidArgument);
+}